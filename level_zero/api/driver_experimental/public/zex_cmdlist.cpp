@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,4 +67,31 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelBatch(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numLaunches,
+    const zex_kernel_launch_desc_t *pLaunches,
+    zex_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    zex_event_handle_t *phWaitEvents) {
+    try {
+        if (nullptr == hCommandList || numLaunches == 0 || nullptr == pLaunches || (numWaitEvents > 0 && nullptr == phWaitEvents)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        for (uint32_t i = 0; i < numLaunches; i++) {
+            if (nullptr == pLaunches[i].hKernel || (pLaunches[i].numArgs > 0 && nullptr == pLaunches[i].pArgs)) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        return L0::CommandList::fromHandle(hCommandList)->appendLaunchKernelBatch(numLaunches, pLaunches, static_cast<ze_event_handle_t>(hSignalEvent), numWaitEvents, static_cast<ze_event_handle_t *>(phWaitEvents), false);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,4 +33,13 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchKernelBatch(
+    zex_command_list_handle_t hCommandList,
+    uint32_t numLaunches,
+    const zex_kernel_launch_desc_t *pLaunches,
+    zex_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    zex_event_handle_t *phWaitEvents);
 } // namespace L0
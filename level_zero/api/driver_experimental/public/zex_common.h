@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,31 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+typedef uint32_t zex_kernel_timestamp_batch_flags_t;
+typedef enum _zex_kernel_timestamp_batch_flag_t {
+    ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS = ZEX_BIT(0),
+    ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_FORCE_UINT32 = 0x7fffffff
+} zex_kernel_timestamp_batch_flag_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel argument value, same as passed to zeKernelSetArgumentValue
+typedef struct _zex_kernel_arg_t {
+    uint32_t argIndex;
+    size_t argSize;
+    const void *pArgValue;
+} zex_kernel_arg_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Single launch appended with zexCommandListAppendLaunchKernelBatch.
+///        Arguments are set on hKernel right before the launch is encoded and stay set after the call.
+///        Arguments are checked before the batch is encoded, except for a kernel whose first launch in the batch has no arguments.
+typedef struct _zex_kernel_launch_desc_t {
+    ze_kernel_handle_t hKernel;
+    ze_group_count_t groupCount;
+    uint32_t numArgs;
+    const zex_kernel_arg_t *pArgs;
+} zex_kernel_launch_desc_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
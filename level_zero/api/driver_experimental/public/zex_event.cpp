@@ -50,6 +50,7 @@ zexCounterBasedEventCreate(ze_context_handle_t hContext, ze_device_handle_t hDev
         false,                             // kerneMappedTsPoolFlag
         false,                             // importedIpcPool
         false,                             // ipcPool
+        0,                                 // allocationOffset
     };
 
     auto device = Device::fromHandle(hDevice);
@@ -66,4 +67,13 @@ zexCounterBasedEventCreate(ze_context_handle_t hContext, ze_device_handle_t hDev
     return ZE_RESULT_SUCCESS;
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestampsBatch(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pResults, zex_kernel_timestamp_batch_flags_t flags) {
+    if (numEvents > 0 && (!phEvents || !pResults)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    return Event::queryKernelTimestamps(numEvents, phEvents, pResults, (flags & ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS) != 0);
+}
+
 } // namespace L0
@@ -27,4 +27,11 @@ zexCounterBasedEventCreate(
     const ze_event_desc_t *desc,
     ze_event_handle_t *phEvent);
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestampsBatch(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_kernel_timestamp_result_t *pResults,
+    zex_kernel_timestamp_batch_flags_t flags);
+
 } // namespace L0
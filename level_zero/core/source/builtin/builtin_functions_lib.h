@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,8 @@ enum class Builtin : uint32_t {
     fillBufferMiddleStateless,
     fillBufferRightLeftover,
     fillBufferRightLeftoverStateless,
+    fillBufferGeneric,
+    fillBufferGenericStateless,
     queryKernelTimestamps,
     queryKernelTimestampsWithOffsets,
     count
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
+#include <chrono>
+
 namespace NEO {
 const char *getAdditionalBuiltinAsString(EBuiltInOps::Type builtin) {
     return nullptr;
@@ -108,6 +110,14 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         builtinName = "FillBufferRightLeftover";
         builtin = NEO::EBuiltInOps::fillBufferStateless;
         break;
+    case Builtin::fillBufferGeneric:
+        builtinName = "FillBufferGeneric";
+        builtin = NEO::EBuiltInOps::fillBuffer;
+        break;
+    case Builtin::fillBufferGenericStateless:
+        builtinName = "FillBufferGeneric";
+        builtin = NEO::EBuiltInOps::fillBufferStateless;
+        break;
     case Builtin::queryKernelTimestamps:
         builtinName = "QueryKernelTimestamps";
         builtin = NEO::EBuiltInOps::queryKernelTimestamps;
@@ -184,28 +194,65 @@ void BuiltinFunctionsLibImpl::initBuiltinImageKernel(ImageBuiltin func) {
 BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib) : device(device), builtInsLib(builtInsLib) {
     if (initBuiltinsAsyncEnabled(device)) {
         this->initAsyncComplete = false;
-        this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::initBuiltinKernel, this, Builtin::fillBufferImmediate);
+        auto preloadAll = NEO::debugManager.flags.EnableBuiltinsPreloadInBackground.get() == 1;
+        this->initAsync = std::async(std::launch::async, &BuiltinFunctionsLibImpl::preloadBuiltins, this, preloadAll);
+    }
+}
+
+void BuiltinFunctionsLibImpl::preloadBuiltins(bool preloadAll) {
+    if (!preloadAll) {
+        ensureBuiltinKernel(Builtin::fillBufferImmediate);
+        return;
+    }
+
+    auto preloadStart = std::chrono::steady_clock::now();
+
+    // copies and fills are the most likely first commands, timestamp queries and images follow
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        ensureBuiltinKernel(static_cast<Builtin>(builtId));
+    }
+    if (device->getNEODevice()->getHardwareInfo().capabilityTable.supportsImages) {
+        for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::count); builtId++) {
+            ensureBuiltinImageKernel(static_cast<ImageBuiltin>(builtId));
+        }
     }
+
+    auto preloadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - preloadStart).count();
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Builtins preloaded in %lld us\n", static_cast<long long>(preloadTime));
+}
+
+void BuiltinFunctionsLibImpl::ensureBuiltinKernel(Builtin func) {
+    auto builtId = static_cast<uint32_t>(func);
+    std::call_once(builtinsInitFlags[builtId], [&]() {
+        if (builtins[builtId].get() == nullptr) {
+            initBuiltinKernel(func);
+        }
+    });
+}
+
+void BuiltinFunctionsLibImpl::ensureBuiltinImageKernel(ImageBuiltin func) {
+    auto builtId = static_cast<uint32_t>(func);
+    std::call_once(imageBuiltinsInitFlags[builtId], [&]() {
+        if (imageBuiltins[builtId].get() == nullptr) {
+            initBuiltinImageKernel(func);
+        }
+    });
 }
 
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
+    UNRECOVERABLE_IF(builtId >= static_cast<uint32_t>(Builtin::count));
 
-    this->ensureInitCompletion();
-    if (builtins[builtId].get() == nullptr) {
-        initBuiltinKernel(func);
-    }
+    ensureBuiltinKernel(func);
 
     return builtins[builtId]->func.get();
 }
 
 Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
+    UNRECOVERABLE_IF(builtId >= static_cast<uint32_t>(ImageBuiltin::count));
 
-    this->ensureInitCompletion();
-    if (imageBuiltins[builtId].get() == nullptr) {
-        initBuiltinImageKernel(func);
-    }
+    ensureBuiltinImageKernel(func);
 
     return imageBuiltins[builtId]->func.get();
 }
@@ -238,10 +285,8 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
     [[maybe_unused]] ze_result_t res;
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
-    }
-
+    UNRECOVERABLE_IF(builtin > NEO::EBuiltInOps::maxCoreValue);
+    std::unique_lock<std::mutex> moduleLock(this->modulesMutexes[builtin]);
     if (this->modules[builtin].get() == nullptr) {
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle;
@@ -255,16 +300,18 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         module.reset(Module::fromHandle(moduleHandle));
         this->modules[builtin] = std::move(module);
     }
+    auto builtinModule = this->modules[builtin].get();
+    moduleLock.unlock();
 
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
     kernelDesc.pKernelName = builtInName;
-    res = this->modules[builtin]->createKernel(&kernelDesc, &kernelHandle);
+    res = builtinModule->createKernel(&kernelDesc, &kernelHandle);
     DEBUG_BREAK_IF(res != ZE_RESULT_SUCCESS);
 
     kernel.reset(Kernel::fromHandle(kernelHandle));
-    return std::unique_ptr<BuiltinData>(new BuiltinData{modules[builtin].get(), std::move(kernel)});
+    return std::unique_ptr<BuiltinData>(new BuiltinData{builtinModule, std::move(kernel)});
 }
 
 void BuiltinFunctionsLibImpl::ensureInitCompletion() {
@@ -1,21 +1,21 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/built_ins/builtinops/built_in_ops.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
 #include <future>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
-namespace EBuiltInOps {
-using Type = uint32_t;
-}
 class BuiltIns;
 } // namespace NEO
 
@@ -27,6 +27,7 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     struct BuiltinData;
     BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *builtInsLib);
     ~BuiltinFunctionsLibImpl() override {
+        ensureInitCompletion();
         builtins->reset();
         imageBuiltins->reset();
     }
@@ -41,12 +42,21 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     static bool initBuiltinsAsyncEnabled(Device *device);
 
   protected:
-    std::vector<std::unique_ptr<Module>> modules = {};
+    void preloadBuiltins(bool preloadAll);
+    void ensureBuiltinKernel(Builtin func);
+    void ensureBuiltinImageKernel(ImageBuiltin func);
+
+    std::unique_ptr<Module> modules[NEO::EBuiltInOps::maxCoreValue + 1];
+    std::mutex modulesMutexes[NEO::EBuiltInOps::maxCoreValue + 1];
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::count)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::count)];
     Device *device;
     NEO::BuiltIns *builtInsLib;
 
+    // builtins are loaded once, either by the background init or by the first user, without waiting for other builtins
+    std::once_flag builtinsInitFlags[static_cast<uint32_t>(Builtin::count)];
+    std::once_flag imageBuiltinsInitFlags[static_cast<uint32_t>(ImageBuiltin::count)];
+
     std::future<void> initAsync = {};
     bool initAsyncComplete = true;
 };
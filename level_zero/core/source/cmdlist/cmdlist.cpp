@@ -100,7 +100,18 @@ bool CommandList::isWaitForEventsFromHostEnabled() {
 }
 
 NEO::GraphicsAllocation *CommandList::getHostPtrAlloc(const void *buffer, uint64_t bufferSize, bool hostCopyAllowed) {
-    NEO::GraphicsAllocation *alloc = getAllocationFromHostPtrMap(buffer, bufferSize);
+    NEO::HostPtrImportCache *hostPtrImportCache = nullptr;
+    if (NEO::debugManager.flags.EnableHostPtrImportCache.get() == 1 && this->storeExternalPtrAsTemporary()) {
+        hostPtrImportCache = static_cast<DeviceImp *>(device)->hostPtrImportCache.get();
+    }
+    NEO::GraphicsAllocation *alloc = nullptr;
+    if (hostPtrImportCache) {
+        alloc = hostPtrImportCache->acquire(buffer, static_cast<size_t>(bufferSize), *this->csr);
+        if (alloc) {
+            return alloc;
+        }
+    }
+    alloc = getAllocationFromHostPtrMap(buffer, bufferSize);
     if (alloc) {
         return alloc;
     }
@@ -108,6 +119,9 @@ NEO::GraphicsAllocation *CommandList::getHostPtrAlloc(const void *buffer, uint64
     if (alloc == nullptr) {
         return nullptr;
     }
+    if (hostPtrImportCache && alloc->getAllocationType() == NEO::AllocationType::externalHostPtr && hostPtrImportCache->insert(alloc, *this->csr)) {
+        return alloc;
+    }
     if (this->storeExternalPtrAsTemporary()) {
         alloc->hostPtrTaskCountAssignment++;
         this->csr->getInternalAllocationStorage()->storeAllocationWithTaskCount(std::unique_ptr<NEO::GraphicsAllocation>(alloc), NEO::AllocationUsage::TEMPORARY_ALLOCATION, this->csr->peekTaskCount());
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_stream/transfer_direction.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/hw_mapper.h"
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/helpers/vec.h"
@@ -71,6 +73,10 @@ struct CommandListCoreFamily : public CommandListImp {
     using CommandListImp::skipInOrderNonWalkerSignalingAllowed;
 
     using CommandListImp::CommandListImp;
+    static constexpr size_t maxGenericFillPatternSize = 128u;
+    static constexpr size_t maxGenericFillSplitSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t genericFillBytesPerWorkItem = 16u;
+
     ze_result_t initialize(Device *device, NEO::EngineGroupType engineGroupType, ze_command_list_flags_t flags) override;
     void programL3(bool isSLMused);
     ~CommandListCoreFamily() override;
@@ -122,6 +128,11 @@ struct CommandListCoreFamily : public CommandListImp {
                                                     ze_event_handle_t hEvent,
                                                     uint32_t numWaitEvents,
                                                     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+    ze_result_t appendLaunchKernelBatch(uint32_t numLaunches,
+                                        const zex_kernel_launch_desc_t *pLaunches,
+                                        ze_event_handle_t hEvent,
+                                        uint32_t numWaitEvents,
+                                        ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
     ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
                                 const void *ptr, size_t size,
                                 ze_memory_advice_t advice) override;
@@ -265,6 +276,16 @@ struct CommandListCoreFamily : public CommandListImp {
                                           const void *pattern,
                                           Event *signalEvent,
                                           const CmdListKernelLaunchParams &launchParams);
+    ze_result_t appendGenericFillKernel(bool isStateless,
+                                        const AlignedAllocationData &dstAllocation,
+                                        const void *pattern,
+                                        size_t patternSize,
+                                        size_t size,
+                                        Event *signalEvent,
+                                        const CmdListKernelLaunchParams &launchParams);
+    NEO::GraphicsAllocation *obtainFillPatternAllocation(const void *pattern, size_t patternSize);
+    bool isGenericFillKernelPreferred(size_t patternSize, size_t size, const CmdListFillKernelArguments &fillArguments) const;
+    static size_t getReducedFillPatternSize(const void *pattern, size_t patternSize);
 
     void appendWaitOnSingleEvent(Event *event, bool relaxedOrderingAllowed);
 
@@ -333,6 +354,7 @@ struct CommandListCoreFamily : public CommandListImp {
     void postInitComputeSetup();
     NEO::PreemptionMode obtainKernelPreemptionMode(Kernel *kernel);
     virtual bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const { return false; }
+    virtual ze_result_t flushKernelBatchIfRequired(Kernel &nextKernel) { return ZE_RESULT_SUCCESS; }
     virtual void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) {}
     bool canSkipInOrderEventWait(const Event &event) const;
     bool handleInOrderImplicitDependencies(bool relaxedOrderingAllowed);
@@ -348,6 +370,7 @@ struct CommandListCoreFamily : public CommandListImp {
     NEO::InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
 
     uint64_t latestHostWaitedInOrderSyncValue = 0;
+    typename NEO::EncodeDispatchKernel<GfxFamily>::EncodeFunction encodeDispatchKernel = NEO::EncodeDispatchKernel<GfxFamily>::getSpecializedEncode(NEO::EncodeDispatchKernelFeatures::all); // specialized in initialize()
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
 };
 
@@ -14,6 +14,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/blit_properties.h"
 #include "shared/source/helpers/compiler_product_helper_base.inl"
@@ -246,6 +247,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
         this->partitionCount = static_cast<uint32_t>(neoDevice->getDeviceBitfield().count());
     }
 
+    if (NEO::debugManager.flags.EnableSpecializedDispatchEncoders.get() == 1) {
+        auto encodeFeatures = NEO::EncodeDispatchKernel<GfxFamily>::getRequiredEncodeFeatures(this->partitionCount);
+        this->encodeDispatchKernel = NEO::EncodeDispatchKernel<GfxFamily>::getSpecializedEncode(encodeFeatures);
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         commandContainer.setFlushTaskUsedForImmediate(this->isFlushTaskSubmissionEnabled);
         commandContainer.setNumIddPerBlock(1);
@@ -521,6 +527,108 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     return ret;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelBatch(uint32_t numLaunches,
+                                                                          const zex_kernel_launch_desc_t *pLaunches,
+                                                                          ze_event_handle_t hEvent,
+                                                                          uint32_t numWaitEvents,
+                                                                          ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    // equivalent to appending the launches one by one, with wait events before the first and signal event on the last one
+    // arguments are set before anything is encoded, so an invalid argument leaves the command list and events untouched
+    // a kernel first launched without arguments keeps its current arguments until that launch is encoded,
+    // so arguments of its later launches are only set right before they are encoded
+    std::vector<Kernel *> launchedKernels;
+    std::vector<Kernel *> kernelsWithDeferredArgs;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        auto &launch = pLaunches[i];
+        auto kernel = Kernel::fromHandle(launch.hKernel);
+        if (std::find(launchedKernels.begin(), launchedKernels.end(), kernel) == launchedKernels.end()) {
+            launchedKernels.push_back(kernel);
+            if (launch.numArgs == 0) {
+                kernelsWithDeferredArgs.push_back(kernel);
+            }
+        }
+        if (std::find(kernelsWithDeferredArgs.begin(), kernelsWithDeferredArgs.end(), kernel) != kernelsWithDeferredArgs.end()) {
+            continue;
+        }
+        for (uint32_t argId = 0; argId < launch.numArgs; argId++) {
+            auto &arg = launch.pArgs[argId];
+            auto ret = kernel->setArgumentValue(arg.argIndex, arg.argSize, arg.pArgValue);
+            if (ret) {
+                return ret;
+            }
+        }
+    }
+
+    // a kernel launched more than once holds the arguments of its last launch, so arguments are applied again before each launch
+    bool reapplyArgs = launchedKernels.size() < numLaunches;
+
+    NEO::Device *neoDevice = device->getNEODevice();
+    uint32_t callId = 0;
+    if (NEO::debugManager.flags.EnableSWTags.get()) {
+        neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameBeginTag>(
+            *commandContainer.getCommandStream(),
+            *neoDevice,
+            "zexCommandListAppendLaunchKernelBatch",
+            ++neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount);
+        callId = neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount;
+    }
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, relaxedOrderingDispatch, true, true);
+    if (ret) {
+        return ret;
+    }
+
+    Event *event = nullptr;
+    if (hEvent) {
+        event = Event::fromHandle(hEvent);
+        event->resetKernelCountAndPacketUsedCount();
+    }
+
+    if (!handleCounterBasedEventOperations(event)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    CmdListKernelLaunchParams launchParams = {};
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        auto &launch = pLaunches[i];
+        auto kernel = Kernel::fromHandle(launch.hKernel);
+        if (i > 0) {
+            ret = flushKernelBatchIfRequired(*kernel);
+            if (ret) {
+                return ret;
+            }
+        }
+
+        if (reapplyArgs) {
+            for (uint32_t argId = 0; argId < launch.numArgs; argId++) {
+                auto &arg = launch.pArgs[argId];
+                ret = kernel->setArgumentValue(arg.argIndex, arg.argSize, arg.pArgValue);
+                if (ret) {
+                    return ret;
+                }
+            }
+        }
+
+        auto launchEvent = (i + 1 == numLaunches) ? event : nullptr;
+        ret = appendLaunchKernelWithParams(kernel, launch.groupCount, launchEvent, launchParams);
+        if (ret) {
+            return ret;
+        }
+        handleInOrderDependencyCounter(launchEvent, isInOrderNonWalkerSignalingRequired(launchEvent));
+    }
+    addToMappedEventList(event);
+    if (NEO::debugManager.flags.EnableSWTags.get()) {
+        neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
+            *commandContainer.getCommandStream(),
+            *neoDevice,
+            "zexCommandListAppendLaunchKernelBatch",
+            callId);
+    }
+
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     auto event = Event::fromHandle(hEvent);
@@ -1833,6 +1941,97 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendUnalignedFillKernel(bool
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendGenericFillKernel(bool isStateless, const AlignedAllocationData &dstAllocation, const void *pattern, size_t patternSize, size_t size, Event *signalEvent, const CmdListKernelLaunchParams &launchParams) {
+    size_t workItems = std::max(static_cast<size_t>(1u), Math::divideAndRoundUp(size, genericFillBytesPerWorkItem));
+    if (workItems > std::numeric_limits<uint32_t>::max()) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    Kernel *builtinKernel = nullptr;
+    if (isStateless) {
+        builtinKernel = device->getBuiltinFunctionsLib()->getFunction(Builtin::fillBufferGenericStateless);
+    } else {
+        builtinKernel = device->getBuiltinFunctionsLib()->getFunction(Builtin::fillBufferGeneric);
+    }
+
+    auto patternGfxAlloc = obtainFillPatternAllocation(pattern, patternSize);
+    if (patternGfxAlloc == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    uint32_t groupSizeX = static_cast<uint32_t>(workItems), groupSizeY = 1, groupSizeZ = 1;
+    builtinKernel->suggestGroupSize(groupSizeX, groupSizeY, groupSizeZ, &groupSizeX, &groupSizeY, &groupSizeZ);
+    ze_result_t ret = builtinKernel->setGroupSize(groupSizeX, groupSizeY, groupSizeZ);
+    if (ret != ZE_RESULT_SUCCESS) {
+        DEBUG_BREAK_IF(true);
+        return ret;
+    }
+    ze_group_count_t dispatchKernelArgs{static_cast<uint32_t>(Math::divideAndRoundUp(workItems, groupSizeX)), 1u, 1u};
+
+    uint64_t dstOffset = dstAllocation.offset;
+    uint64_t sizeInBytes = size;
+    uint32_t patternSizeInBytes = static_cast<uint32_t>(patternSize);
+    builtinKernel->setArgBufferWithAlloc(0, dstAllocation.alignedAllocationPtr, dstAllocation.alloc, nullptr);
+    builtinKernel->setArgumentValue(1, sizeof(dstOffset), &dstOffset);
+    builtinKernel->setArgumentValue(2, sizeof(sizeInBytes), &sizeInBytes);
+    builtinKernel->setArgBufferWithAlloc(3, reinterpret_cast<uintptr_t>(patternGfxAlloc->getUnderlyingBuffer()), patternGfxAlloc, nullptr);
+    builtinKernel->setArgumentValue(4, sizeof(patternSizeInBytes), &patternSizeInBytes);
+
+    return appendLaunchKernelSplit(builtinKernel, dispatchKernelArgs, signalEvent, launchParams);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::GraphicsAllocation *CommandListCoreFamily<gfxCoreFamily>::obtainFillPatternAllocation(const void *pattern, size_t patternSize) {
+    size_t patternAllocationSize = alignUp(patternSize, MemoryConstants::cacheLineSize);
+    auto patternGfxAlloc = device->obtainReusableAllocation(patternAllocationSize, NEO::AllocationType::fillPattern);
+    if (patternGfxAlloc == nullptr) {
+        NEO::AllocationProperties allocationProperties{device->getNEODevice()->getRootDeviceIndex(),
+                                                       patternAllocationSize,
+                                                       NEO::AllocationType::fillPattern,
+                                                       device->getNEODevice()->getDeviceBitfield()};
+        allocationProperties.alignment = MemoryConstants::pageSize;
+        patternGfxAlloc = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties(allocationProperties);
+        if (patternGfxAlloc == nullptr) {
+            return nullptr;
+        }
+    }
+    patternAllocations.push_back(patternGfxAlloc);
+
+    // pattern is repeated over the whole allocation, the last copy is truncated at the allocation end
+    auto patternAllocPtr = reinterpret_cast<uint8_t *>(patternGfxAlloc->getUnderlyingBuffer());
+    for (size_t patternAllocOffset = 0; patternAllocOffset < patternAllocationSize; patternAllocOffset += patternSize) {
+        auto patternSizeToCopy = std::min(patternSize, patternAllocationSize - patternAllocOffset);
+        memcpy_s(patternAllocPtr + patternAllocOffset, patternSizeToCopy, pattern, patternSizeToCopy);
+    }
+    return patternGfxAlloc;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isGenericFillKernelPreferred(size_t patternSize, size_t size, const CmdListFillKernelArguments &fillArguments) const {
+    if (NEO::debugManager.flags.EnableGenericFillKernel.get() != 1 || patternSize > maxGenericFillPatternSize) {
+        return false;
+    }
+    // legacy kernels index the pattern with a mask, so other pattern sizes are filled correctly by the generic kernel only, whatever the fill size
+    if (!Math::isPow2(patternSize)) {
+        return true;
+    }
+    // generic kernel stores single bytes, for power of 2 patterns it saves launches only where they dominate over the write bandwidth
+    bool splitLaunchRequired = fillArguments.leftRemainingBytes > 0 || fillArguments.rightRemainingBytes > 0;
+    return splitLaunchRequired && size <= maxGenericFillSplitSize;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamily<gfxCoreFamily>::getReducedFillPatternSize(const void *pattern, size_t patternSize) {
+    auto patternBytes = reinterpret_cast<const uint8_t *>(pattern);
+    for (size_t period = 1; period < patternSize; period++) {
+        if (patternSize % period == 0 && memcmp(patternBytes, patternBytes + period, patternSize - period) == 0) {
+            return period;
+        }
+    }
+    return patternSize;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
                                                                    const void *pattern,
@@ -1864,6 +2063,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
         dcFlush = getDcFlushRequired(signalEvent->isSignalScope());
     }
 
+    if (NEO::debugManager.flags.EnableFillPatternReduction.get() == 1) {
+        patternSize = getReducedFillPatternSize(pattern, patternSize);
+    }
+
     if (isCopyOnly()) {
         auto status = appendBlitFill(ptr, pattern, patternSize, size, signalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
         addToMappedEventList(signalEvent);
@@ -1926,6 +2129,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
     CmdListFillKernelArguments fillArguments = {};
     setupFillKernelArguments(dstAllocation.offset, patternSize, size, fillArguments, builtinKernel);
 
+    bool useGenericFill = isGenericFillKernelPreferred(patternSize, size, fillArguments);
+    if (useGenericFill) {
+        fillArguments = {};
+    }
+
     launchParams.isKernelSplitOperation = (fillArguments.leftRemainingBytes > 0 || fillArguments.rightRemainingBytes > 0);
     bool singlePipeControlPacket = eventSignalPipeControl(launchParams.isKernelSplitOperation, dcFlush);
 
@@ -1938,7 +2146,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
         launchParams.numKernelsInSplitLaunch++;
     }
 
-    if (patternSize == 1) {
+    if (useGenericFill) {
+        launchParams.numKernelsInSplitLaunch++;
+        res = appendGenericFillKernel(isStateless, dstAllocation, pattern, patternSize, size, signalEvent, launchParams);
+        if (res) {
+            return res;
+        }
+        launchParams.numKernelsExecutedInSplitLaunch++;
+    } else if (patternSize == 1) {
         launchParams.numKernelsInSplitLaunch++;
         if (fillArguments.leftRemainingBytes > 0) {
             res = appendUnalignedFillKernel(isStateless, fillArguments.leftRemainingBytes, dstAllocation, pattern, signalEvent, launchParams);
@@ -1980,30 +2195,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
         builtinKernel->setGroupSize(static_cast<uint32_t>(fillArguments.mainGroupSize), 1, 1);
 
         size_t patternAllocationSize = alignUp(patternSize, MemoryConstants::cacheLineSize);
-        auto patternGfxAlloc = device->obtainReusableAllocation(patternAllocationSize, NEO::AllocationType::fillPattern);
+        auto patternGfxAlloc = obtainFillPatternAllocation(pattern, patternSize);
         if (patternGfxAlloc == nullptr) {
-            NEO::AllocationProperties allocationProperties{device->getNEODevice()->getRootDeviceIndex(),
-                                                           patternAllocationSize,
-                                                           NEO::AllocationType::fillPattern,
-                                                           device->getNEODevice()->getDeviceBitfield()};
-            allocationProperties.alignment = MemoryConstants::pageSize;
-            patternGfxAlloc = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties(allocationProperties);
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
         }
         void *patternGfxAllocPtr = patternGfxAlloc->getUnderlyingBuffer();
-        patternAllocations.push_back(patternGfxAlloc);
-        uint64_t patternAllocPtr = reinterpret_cast<uintptr_t>(patternGfxAllocPtr);
-        uint64_t patternAllocOffset = 0;
-        uint64_t patternSizeToCopy = patternSize;
-        do {
-            memcpy_s(reinterpret_cast<void *>(patternAllocPtr + patternAllocOffset),
-                     patternSizeToCopy, pattern, patternSizeToCopy);
-
-            if ((patternAllocOffset + patternSizeToCopy) > patternAllocationSize) {
-                patternSizeToCopy = patternAllocationSize - patternAllocOffset;
-            }
-
-            patternAllocOffset += patternSizeToCopy;
-        } while (patternAllocOffset < patternAllocationSize);
         if (fillArguments.leftRemainingBytes == 0) {
             builtinKernel->setArgBufferWithAlloc(0, dstAllocation.alignedAllocationPtr, dstAllocation.alloc, nullptr);
             builtinKernel->setArgumentValue(1, sizeof(dstAllocation.offset), &dstAllocation.offset);
@@ -3157,9 +3353,16 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 inline bool CommandListCoreFamily<gfxCoreFamily>::isAppendSplitNeeded(NEO::MemoryPool dstPool, NEO::MemoryPool srcPool, size_t size, NEO::TransferDirection &directionOut) {
     directionOut = NEO::createTransferDirection(!NEO::MemoryPoolHelper::isSystemMemoryPool(srcPool), !NEO::MemoryPoolHelper::isSystemMemoryPool(dstPool));
 
-    return this->isBcsSplitNeeded &&
-           size >= minimalSizeForBcsSplit &&
-           directionOut != NEO::TransferDirection::localToLocal;
+    if (!this->isBcsSplitNeeded || size < minimalSizeForBcsSplit || directionOut == NEO::TransferDirection::localToLocal) {
+        return false;
+    }
+
+    auto &bcsSplit = static_cast<DeviceImp *>(this->device)->bcsSplit;
+    if (bcsSplit.adaptiveSplit && NEO::debugManager.flags.SplitBcsSize.get() == -1) {
+        return size >= bcsSplit.getAdaptiveMinimalSplitSize();
+    }
+
+    return true;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/transfer_planner.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
@@ -63,6 +64,12 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
                                            ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
 
+    ze_result_t appendLaunchKernelBatch(uint32_t numLaunches,
+                                        const zex_kernel_launch_desc_t *pLaunches,
+                                        ze_event_handle_t hSignalEvent,
+                                        uint32_t numWaitEvents,
+                                        ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+
     ze_result_t appendBarrier(ze_event_handle_t hSignalEvent,
                               uint32_t numWaitEvents,
                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
@@ -178,10 +185,14 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isSuitableUSMDeviceAlloc(NEO::SvmAllocationData *alloc);
     bool isSuitableUSMSharedAlloc(NEO::SvmAllocationData *alloc);
     ze_result_t performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool preferStagingTransfer(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents);
+    ze_result_t performStagingTransfer(const CpuMemCopyInfo &cpuMemCopyInfo);
     void *obtainLockedPtrFromDevice(NEO::SvmAllocationData *alloc, void *ptr, bool &lockingFailed);
     bool waitForEventsFromHost();
     TransferType getTransferType(const CpuMemCopyInfo &cpuMemCopyInfo);
     size_t getTransferThreshold(TransferType transferType);
+    NEO::TransferDirection getTransferDirection(const CpuMemCopyInfo &cpuMemCopyInfo);
+    NEO::TransferPath getGpuTransferPath() const { return isCopyOnly() ? NEO::TransferPath::copyEngine : NEO::TransferPath::computeKernel; }
     bool isBarrierRequired();
     bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const override;
     bool skipInOrderNonWalkerSignalingAllowed(ze_event_handle_t signalEvent) const override;
@@ -196,6 +207,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) override;
     bool isSkippingInOrderBarrierAllowed(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) const;
     void allocateOrReuseKernelPrivateMemoryIfNeeded(Kernel *kernel, uint32_t sizePerHwThread) override;
+    ze_result_t flushKernelBatchIfRequired(Kernel &nextKernel) override;
+    bool isFlushRequiredBeforeBatchedLaunch(Kernel &nextKernel);
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
 
     MOCKABLE_VIRTUAL void checkAssert();
@@ -12,16 +12,21 @@
 #include "shared/source/command_container/encode_surface_state.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/command_stream/staging_transfer_engine.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/in_order_cmd_helpers.h"
+#include "shared/source/helpers/memcpy_engine.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -39,6 +44,7 @@
 
 #include "encode_surface_state_args.h"
 
+#include <chrono>
 #include <cmath>
 
 namespace L0 {
@@ -498,6 +504,72 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     return flushImmediate(ret, true, hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch), relaxedOrderingDispatch, true, hSignalEvent);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelBatch(
+    uint32_t numLaunches, const zex_kernel_launch_desc_t *pLaunches,
+    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+
+    // a batch may be submitted in several parts, which is not supported by relaxed ordering dependencies
+    relaxedOrderingDispatch = false;
+    bool stallingCmds = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
+
+    checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
+    if (waitForEventsFromHost()) {
+        this->synchronizeEventList(numWaitEvents, phWaitEvents);
+        numWaitEvents = 0u;
+        phWaitEvents = nullptr;
+    }
+
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelBatch(numLaunches, pLaunches, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+
+    return flushImmediate(ret, true, stallingCmds, relaxedOrderingDispatch, true, hSignalEvent);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushKernelBatchIfRequired(Kernel &nextKernel) {
+    if (!isFlushRequiredBeforeBatchedLaunch(nextKernel)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto ret = flushImmediate(ZE_RESULT_SUCCESS, true, true, false, true, nullptr);
+    checkAvailableSpace(0u, false, commonImmediateCommandSize);
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushRequiredBeforeBatchedLaunch(Kernel &nextKernel) {
+    // heaps running out of space are replaced and the old ones are recycled after the latest submitted task,
+    // launches not submitted yet must not refer to them
+    auto &container = this->commandContainer;
+    if (container.getCommandStream()->getAvailableSpace() < commonImmediateCommandSize) {
+        return true;
+    }
+
+    auto hasHeapSpace = [&container](NEO::HeapType heapType, size_t size, size_t alignment) {
+        auto heap = container.getIndirectHeap(heapType);
+        return heap == nullptr || heap->getAvailableSpace() >= size + alignment;
+    };
+
+    auto iohSize = nextKernel.getCrossThreadDataSize() + nextKernel.getPerThreadDataSizeForWholeThreadGroup() + NEO::ImplicitArgs::getSize();
+    if (!hasHeapSpace(NEO::HeapType::indirectObject, iohSize, GfxFamily::DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE)) {
+        return true;
+    }
+
+    if (this->cmdListHeapAddressModel == NEO::HeapAddressModel::privateHeaps) {
+        auto &kernelDescriptor = nextKernel.getKernelDescriptor();
+        if (!hasHeapSpace(NEO::HeapType::surfaceState, NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredSsh(*nextKernel.getImmutableData()->getKernelInfo()),
+                          NEO::EncodeDispatchKernel<GfxFamily>::getDefaultSshAlignment())) {
+            return true;
+        }
+        if (this->dynamicHeapRequired &&
+            !hasHeapSpace(NEO::HeapType::dynamicState, NEO::EncodeDispatchKernel<GfxFamily>::getSizeRequiredDsh(kernelDescriptor, 0),
+                          NEO::EncodeDispatchKernel<GfxFamily>::getDefaultDshAlignment())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSkippingInOrderBarrierAllowed(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) const {
     uint32_t eventsToWait = numWaitEvents;
@@ -575,9 +647,25 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
             return ret;
         }
     }
+    if (preferStagingTransfer(cpuMemCopyInfo, hSignalEvent, numWaitEvents)) {
+        ret = performStagingTransfer(cpuMemCopyInfo);
+        if (ret == ZE_RESULT_SUCCESS || ret == ZE_RESULT_ERROR_DEVICE_LOST) {
+            return ret;
+        }
+    }
 
     NEO::TransferDirection direction;
     auto isSplitNeeded = this->isAppendSplitNeeded(dstptr, srcptr, size, direction);
+
+    // synchronous lists block until the copy is done, so the append duration is the GPU path cost,
+    // unless the copy also waits for events or earlier in-order work
+    const bool recordGpuTransfer = this->isSyncModeQueue && !isSplitNeeded && numWaitEvents == 0 && !this->hasInOrderDependencies() &&
+                                   NEO::debugManager.flags.EnableTransferPlanner.get() == 1;
+    std::chrono::steady_clock::time_point appendStartTime;
+    if (recordGpuTransfer) {
+        appendStartTime = std::chrono::steady_clock::now();
+    }
+
     if (isSplitNeeded) {
         relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
         hasStallindCmds = !relaxedOrderingDispatch;
@@ -590,7 +678,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
                                                                      numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
     }
 
-    return flushImmediate(ret, true, hasStallindCmds, relaxedOrderingDispatch, true, hSignalEvent);
+    ret = flushImmediate(ret, true, hasStallindCmds, relaxedOrderingDispatch, true, hSignalEvent);
+
+    if (recordGpuTransfer && ret == ZE_RESULT_SUCCESS) {
+        auto gpuCopyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - appendStartTime).count();
+        static_cast<DeviceImp *>(this->device)->transferPlanner.recordTransfer(getGpuTransferPath(), getTransferDirection(cpuMemCopyInfo), size, static_cast<uint64_t>(gpuCopyNs));
+    }
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -999,6 +1093,13 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(C
         break;
     }
 
+    if (cpuMemCopyEnabled && NEO::debugManager.flags.EnableTransferPlanner.get() == 1) {
+        auto &transferPlanner = static_cast<DeviceImp *>(this->device)->transferPlanner;
+        auto availablePaths = NEO::getTransferPathMask(NEO::TransferPath::cpu) | NEO::getTransferPathMask(getGpuTransferPath());
+        auto transferPlan = transferPlanner.plan(getTransferDirection(cpuMemCopyInfo), cpuMemCopyInfo.size, availablePaths, false);
+        return transferPlan.primaryPath == NEO::TransferPath::cpu;
+    }
+
     return cpuMemCopyEnabled && cpuMemCopyInfo.size <= transferThreshold;
 }
 
@@ -1019,6 +1120,49 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSuitableUSMSharedAlloc(NEO
     return alloc && (alloc->memoryType == InternalMemoryType::sharedUnifiedMemory);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferStagingTransfer(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents) {
+    if (!NEO::StagingTransferEngine::isEnabled() || !isCopyOnly() || !this->isSyncModeQueue || this->isInOrderExecutionEnabled() ||
+        hSignalEvent != nullptr || numWaitEvents > 0 || this->dependenciesPresent) {
+        return false;
+    }
+
+    auto isDeviceUsm = [](NEO::SvmAllocationData *allocData) {
+        return allocData != nullptr && allocData->memoryType == InternalMemoryType::deviceUnifiedMemory && !allocData->isImportedAllocation;
+    };
+    auto isUnpinnedHostPtr = [this](NEO::SvmAllocationData *allocData, void *ptr, size_t size) {
+        return allocData == nullptr && this->getDevice()->getDriverHandle()->findHostPointerAllocation(ptr, size, this->getDevice()->getRootDeviceIndex()) == nullptr;
+    };
+    const bool hostToDevice = isDeviceUsm(cpuMemCopyInfo.dstAllocData) && isUnpinnedHostPtr(cpuMemCopyInfo.srcAllocData, cpuMemCopyInfo.srcPtr, cpuMemCopyInfo.size);
+    const bool deviceToHost = isDeviceUsm(cpuMemCopyInfo.srcAllocData) && isUnpinnedHostPtr(cpuMemCopyInfo.dstAllocData, cpuMemCopyInfo.dstPtr, cpuMemCopyInfo.size);
+    if (!hostToDevice && !deviceToHost) {
+        return false;
+    }
+    return this->device->getNEODevice()->getStagingTransferEngine()->isTransferSizeSupported(cpuMemCopyInfo.size);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performStagingTransfer(const CpuMemCopyInfo &cpuMemCopyInfo) {
+    auto stagingTransferEngine = this->device->getNEODevice()->getStagingTransferEngine();
+    const auto rootDeviceIndex = this->device->getRootDeviceIndex();
+
+    NEO::BlitOperationResult result;
+    if (cpuMemCopyInfo.dstAllocData) {
+        auto dstAllocation = cpuMemCopyInfo.dstAllocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+        auto dstOffset = ptrDiff(cpuMemCopyInfo.dstPtr, dstAllocation->getGpuAddress());
+        result = stagingTransferEngine->write(*this->csr, dstAllocation, dstOffset, cpuMemCopyInfo.srcPtr, cpuMemCopyInfo.size);
+    } else {
+        auto srcAllocation = cpuMemCopyInfo.srcAllocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+        auto srcOffset = ptrDiff(cpuMemCopyInfo.srcPtr, srcAllocation->getGpuAddress());
+        result = stagingTransferEngine->read(*this->csr, srcAllocation, srcOffset, cpuMemCopyInfo.dstPtr, cpuMemCopyInfo.size);
+    }
+
+    if (result == NEO::BlitOperationResult::gpuHang) {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    }
+    return result == NEO::BlitOperationResult::success ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     bool lockingFailed = false;
@@ -1085,7 +1229,24 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    const bool transferPlannerEnabled = NEO::debugManager.flags.EnableTransferPlanner.get() == 1;
+    std::chrono::steady_clock::time_point cpuCopyStartTime;
+    if (transferPlannerEnabled) {
+        cpuCopyStartTime = std::chrono::steady_clock::now();
+    }
+
+    if (NEO::debugManager.flags.EnableStreamingCpuCopy.get() == 1) {
+        auto copyHint = dstLockPointer ? NEO::MemcpyHint::writeCombinedDestination
+                                       : (srcLockPointer ? NEO::MemcpyHint::uncachedSource : NEO::MemcpyHint::cacheable);
+        NEO::MemcpyEngine::copy(cpuMemcpyDstPtr, cpuMemcpySrcPtr, cpuMemCopyInfo.size, copyHint, this->device->getNEODevice()->getExecutionEnvironment()->getMemcpyThreadPool());
+    } else {
+        memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    }
+
+    if (transferPlannerEnabled) {
+        auto cpuCopyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - cpuCopyStartTime).count();
+        static_cast<DeviceImp *>(this->device)->transferPlanner.recordTransfer(NEO::TransferPath::cpu, getTransferDirection(cpuMemCopyInfo), cpuMemCopyInfo.size, static_cast<uint64_t>(cpuCopyNs));
+    }
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -1192,6 +1353,11 @@ TransferType CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferType(cons
     return TransferType::unknown;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::TransferDirection CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferDirection(const CpuMemCopyInfo &cpuMemCopyInfo) {
+    return NEO::createTransferDirection(isSuitableUSMDeviceAlloc(cpuMemCopyInfo.srcAllocData), isSuitableUSMDeviceAlloc(cpuMemCopyInfo.dstAllocData));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 size_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getTransferThreshold(TransferType transferType) {
     size_t retVal = 0u;
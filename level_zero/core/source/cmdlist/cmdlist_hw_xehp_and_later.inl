@@ -21,6 +21,7 @@
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/software_tags_manager.h"
+#include "shared/source/utilities/submission_tracer.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/device/device.h"
@@ -162,17 +163,20 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
 
     auto kernelPreemptionMode = obtainKernelPreemptionMode(kernel);
 
-    kernel->patchGlobalOffset();
-    kernel->patchRegionParams(launchParams);
-    this->allocateOrReuseKernelPrivateMemoryIfNeeded(kernel, kernelDescriptor.kernelAttributes.perHwThreadPrivateMemorySize);
+    {
+        NEO::SubmissionTraceScope traceScope(NEO::SubmissionStage::argumentPatching);
+        kernel->patchGlobalOffset();
+        kernel->patchRegionParams(launchParams);
+        this->allocateOrReuseKernelPrivateMemoryIfNeeded(kernel, kernelDescriptor.kernelAttributes.perHwThreadPrivateMemorySize);
 
-    if (launchParams.isIndirect) {
-        prepareIndirectParams(&threadGroupDimensions);
-    }
-    if (!launchParams.isIndirect) {
-        kernel->setGroupCount(threadGroupDimensions.groupCountX,
-                              threadGroupDimensions.groupCountY,
-                              threadGroupDimensions.groupCountZ);
+        if (launchParams.isIndirect) {
+            prepareIndirectParams(&threadGroupDimensions);
+        }
+        if (!launchParams.isIndirect) {
+            kernel->setGroupCount(threadGroupDimensions.groupCountX,
+                                  threadGroupDimensions.groupCountY,
+                                  threadGroupDimensions.groupCountZ);
+        }
     }
 
     uint64_t eventAddress = 0;
@@ -329,7 +333,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         interruptEvent,                                         // interruptEvent
     };
 
-    NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
+    {
+        NEO::SubmissionTraceScope traceScope(NEO::SubmissionStage::dispatchEncoding);
+        this->encodeDispatchKernel(commandContainer, dispatchKernelArgs);
+    }
 
     if (!this->isFlushTaskSubmissionEnabled) {
         this->containsStatelessUncachedResource = dispatchKernelArgs.requiresUncachedMocs;
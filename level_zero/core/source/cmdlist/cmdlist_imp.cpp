@@ -158,6 +158,9 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
             if (returnValue != ZE_RESULT_SUCCESS) {
                 return commandList;
             }
+            if (NEO::debugManager.flags.EnableImmediateCmdListLoadBalancing.get() == 1) {
+                csr = deviceImp->getLeastBusyCsrForOrdinal(desc->ordinal, csr);
+            }
         }
 
         UNRECOVERABLE_IF(nullptr == csr);
@@ -206,6 +209,9 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         commandList->commandListPreemptionMode = device->getDevicePreemptionMode();
 
         commandList->isBcsSplitNeeded = deviceImp->bcsSplit.setupDevice(productFamily, internalUsage, desc, csr);
+        if (commandList->isBcsSplitNeeded && deviceImp->bcsSplit.adaptiveSplit && NEO::debugManager.flags.SplitBcsSize.get() == -1) {
+            commandList->minimalSizeForBcsSplit = BcsSplit::minAdaptiveSplitSize;
+        }
 
         commandList->copyThroughLockedPtrEnabled = gfxCoreHelper.copyThroughLockedPtrEnabled(hwInfo, device->getProductHelper());
 
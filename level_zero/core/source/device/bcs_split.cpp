@@ -9,10 +9,15 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/os_context.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
+#include <algorithm>
+#include <limits>
+#include <thread>
+
 namespace L0 {
 
 bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr) {
@@ -86,6 +91,23 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
         }
     }
 
+    this->adaptiveSplit = NEO::debugManager.flags.EnableAdaptiveBcsSplit.get() == 1;
+    if (this->adaptiveSplit) {
+        const auto maxSets = Events::maxLockFreeEventSets;
+        this->events.marker.reserve(maxSets);
+        this->events.barrier.reserve(maxSets);
+        this->events.subcopy.reserve(maxSets * this->cmdQs.size());
+        this->events.subcopySizes.assign(maxSets * this->cmdQs.size(), 0u);
+        this->events.subcopyCmdQs.assign(maxSets * this->cmdQs.size(), nullptr);
+        this->engineBytesPerNs = std::vector<std::atomic<double>>(this->cmdQs.size());
+        for (auto &bandwidth : this->engineBytesPerNs) {
+            bandwidth.store(0.0, std::memory_order_relaxed);
+        }
+        this->singleEngineBytesPerNs.store(0.0, std::memory_order_relaxed);
+        this->adaptiveSplitsCount.store(0u, std::memory_order_relaxed);
+        this->adaptiveMinimalSplitSize.store(defaultAdaptiveSplitSize, std::memory_order_relaxed);
+    }
+
     return true;
 }
 
@@ -101,7 +123,141 @@ void BcsSplit::releaseResources() {
         d2hCmdQs.clear();
         h2dCmdQs.clear();
         this->events.releaseResources();
+        this->engineBytesPerNs.clear();
+    }
+}
+
+size_t BcsSplit::getEngineIndex(CommandQueue *cmdQ) const {
+    auto it = std::find(this->cmdQs.begin(), this->cmdQs.end(), cmdQ);
+    UNRECOVERABLE_IF(it == this->cmdQs.end());
+    return static_cast<size_t>(std::distance(this->cmdQs.begin(), it));
+}
+
+StackVec<size_t, 4> BcsSplit::getAdaptiveChunkSizes(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size) {
+    // Each engine gets a share proportional to its measured bandwidth, scaled down by the work already queued on it.
+    // Engines without samples yet assume the average of the measured ones, so the first splits are even.
+    // Every singleEngineProbePeriod-th split runs on the least loaded engine only, as the reference the split gain is measured against.
+    StackVec<double, 4> weights;
+    double measuredSum = 0.0;
+    size_t measuredCount = 0u;
+    for (auto cmdQ : cmdQsForSplit) {
+        auto bandwidth = this->engineBytesPerNs[getEngineIndex(cmdQ)].load(std::memory_order_relaxed);
+        if (bandwidth > 0.0) {
+            measuredSum += bandwidth;
+            measuredCount++;
+        }
+    }
+    const double defaultBandwidth = measuredCount > 0u ? measuredSum / static_cast<double>(measuredCount) : 1.0;
+
+    double maxWeight = 0.0;
+    for (auto cmdQ : cmdQsForSplit) {
+        auto bandwidth = this->engineBytesPerNs[getEngineIndex(cmdQ)].load(std::memory_order_relaxed);
+        if (bandwidth <= 0.0) {
+            bandwidth = defaultBandwidth;
+        }
+        auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
+        auto completedTaskCount = static_cast<NEO::TaskCountType>(*csr->getTagAddress());
+        auto taskCount = csr->peekTaskCount();
+        auto outstanding = taskCount > completedTaskCount ? taskCount - completedTaskCount : 0u;
+
+        auto weight = bandwidth / (1.0 + static_cast<double>(outstanding));
+        weights.push_back(weight);
+        maxWeight = std::max(maxWeight, weight);
+    }
+
+    const bool singleEngineProbe = (this->adaptiveSplitsCount.fetch_add(1, std::memory_order_relaxed) + 1) % singleEngineProbePeriod == 0;
+    bool probeEngineAssigned = false;
+
+    double weightSum = 0.0;
+    for (auto &weight : weights) {
+        if (weight < maxWeight * busyEngineWeightRatio) {
+            weight = 0.0;
+        }
+        if (singleEngineProbe) {
+            if (weight < maxWeight || probeEngineAssigned) {
+                weight = 0.0;
+            }
+            probeEngineAssigned |= weight > 0.0;
+        }
+        weightSum += weight;
+    }
+
+    StackVec<size_t, 4> chunkSizes;
+    size_t lastUsedEngine = 0u;
+    size_t assigned = 0u;
+    for (size_t i = 0; i < weights.size(); i++) {
+        auto chunkSize = static_cast<size_t>(static_cast<double>(size) * (weights[i] / weightSum));
+        chunkSize = std::min(alignDown(chunkSize, MemoryConstants::pageSize), size - assigned);
+        chunkSizes.push_back(chunkSize);
+        assigned += chunkSize;
+        if (weights[i] > 0.0) {
+            lastUsedEngine = i;
+        }
+    }
+    chunkSizes[lastUsedEngine] += size - assigned;
+
+    return chunkSizes;
+}
+
+void BcsSplit::recordSplitCompletion(size_t setIndex) {
+    const auto resolution = this->device.getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    const auto subcopyEventIndex = setIndex * this->cmdQs.size();
+
+    size_t totalSize = 0u;
+    size_t subcopiesCount = 0u;
+    uint64_t splitStart = std::numeric_limits<uint64_t>::max();
+    uint64_t splitEnd = 0u;
+    for (size_t i = 0; i < this->cmdQs.size(); i++) {
+        auto size = this->events.subcopySizes[subcopyEventIndex + i];
+        auto cmdQ = this->events.subcopyCmdQs[subcopyEventIndex + i];
+        if (size == 0u || cmdQ == nullptr) {
+            continue;
+        }
+
+        ze_kernel_timestamp_result_t timestamp{};
+        if (this->events.subcopy[subcopyEventIndex + i]->queryKernelTimestamp(&timestamp) != ZE_RESULT_SUCCESS ||
+            timestamp.global.kernelEnd <= timestamp.global.kernelStart) {
+            return;
+        }
+        auto durationNs = static_cast<double>(timestamp.global.kernelEnd - timestamp.global.kernelStart) * resolution;
+
+        auto &bandwidth = this->engineBytesPerNs[getEngineIndex(cmdQ)];
+        auto sample = static_cast<double>(size) / durationNs;
+        auto previous = bandwidth.load(std::memory_order_relaxed);
+        bandwidth.store(previous > 0.0 ? previous + (sample - previous) * bandwidthWeight : sample, std::memory_order_relaxed);
+
+        totalSize += size;
+        subcopiesCount++;
+        splitStart = std::min(splitStart, timestamp.global.kernelStart);
+        splitEnd = std::max(splitEnd, timestamp.global.kernelEnd);
+    }
+
+    if (subcopiesCount == 0u) {
+        return;
+    }
+
+    // Subcopies run concurrently, so the split throughput is the total size over the wall span from the first start to the last end.
+    auto splitBytesPerNs = static_cast<double>(totalSize) / (static_cast<double>(splitEnd - splitStart) * resolution);
+    if (subcopiesCount == 1u) {
+        auto previous = this->singleEngineBytesPerNs.load(std::memory_order_relaxed);
+        this->singleEngineBytesPerNs.store(previous > 0.0 ? previous + (splitBytesPerNs - previous) * bandwidthWeight : splitBytesPerNs, std::memory_order_relaxed);
+        return;
+    }
+
+    auto singleEngineBytesPerNs = this->singleEngineBytesPerNs.load(std::memory_order_relaxed);
+    if (singleEngineBytesPerNs <= 0.0) {
+        return;
+    }
+
+    // Splitting pays off only if the engines together move data faster than one engine alone;
+    // otherwise the per-engine submission overhead dominates and larger copies are needed to amortize it.
+    auto threshold = this->adaptiveMinimalSplitSize.load(std::memory_order_relaxed);
+    if (splitBytesPerNs < singleEngineBytesPerNs * 1.1) {
+        threshold = std::min(maxAdaptiveSplitSize, threshold + threshold / 4);
+    } else if (splitBytesPerNs > singleEngineBytesPerNs * 1.5) {
+        threshold = std::max(minAdaptiveSplitSize, threshold - threshold / 5);
     }
+    this->adaptiveMinimalSplitSize.store(threshold, std::memory_order_relaxed);
 }
 
 std::vector<CommandQueue *> &BcsSplit::getCmdQsForSplit(NEO::TransferDirection direction) {
@@ -119,11 +275,7 @@ size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountIn
     for (size_t i = 0; i < this->marker.size(); i++) {
         auto ret = this->marker[i]->queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
-            this->marker[i]->reset();
-            this->barrier[i]->reset();
-            for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
-                this->subcopy[i * this->bcsSplit.cmdQs.size() + j]->reset();
-            }
+            this->resetSet(i);
             return i;
         }
     }
@@ -131,6 +283,70 @@ size_t BcsSplit::Events::obtainForSplit(Context *context, size_t maxEventCountIn
     return this->allocateNew(context, maxEventCountInPool);
 }
 
+size_t BcsSplit::Events::obtainForSplitLockFree(Context *context, size_t maxEventCountInPool) {
+    auto setsCount = this->publishedSets.load(std::memory_order_acquire);
+    auto startIndex = setsCount > 0u ? this->nextSetHint.load(std::memory_order_relaxed) % setsCount : 0u;
+    for (size_t n = 0; n < setsCount; n++) {
+        auto i = (startIndex + n) % setsCount;
+        bool expected = false;
+        if (!this->setInUse[i].compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            continue;
+        }
+        if (this->marker[i]->queryStatus() != ZE_RESULT_SUCCESS) {
+            this->releaseSet(i);
+            continue;
+        }
+        this->bcsSplit.recordSplitCompletion(i);
+        this->resetSet(i);
+        this->nextSetHint.store(i + 1, std::memory_order_relaxed);
+        return i;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        if (this->marker.size() < maxLockFreeEventSets) {
+            auto index = this->allocateNew(context, maxEventCountInPool);
+            this->setInUse[index].store(true, std::memory_order_relaxed);
+            this->publishedSets.store(this->marker.size(), std::memory_order_release);
+            return index;
+        }
+    }
+
+    return this->waitForPendingSet();
+}
+
+size_t BcsSplit::Events::waitForPendingSet() {
+    // Storage cannot grow past maxLockFreeEventSets while sets are read without the lock, so block on
+    // the split still in flight in the next set instead of polling. Sets are claimed only for the
+    // duration of an append, so a set not claimed by another thread is found within a few rounds.
+    for (size_t attempt = 1;; attempt++) {
+        auto i = this->nextSetHint.fetch_add(1, std::memory_order_relaxed) % maxLockFreeEventSets;
+        bool expected = false;
+        if (!this->setInUse[i].compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            if (attempt % maxLockFreeEventSets == 0) {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+        this->marker[i]->hostSynchronize(std::numeric_limits<uint64_t>::max());
+        this->bcsSplit.recordSplitCompletion(i);
+        this->resetSet(i);
+        return i;
+    }
+}
+
+void BcsSplit::Events::resetSet(size_t setIndex) {
+    this->marker[setIndex]->reset();
+    this->barrier[setIndex]->reset();
+    for (size_t j = 0; j < this->bcsSplit.cmdQs.size(); j++) {
+        this->subcopy[setIndex * this->bcsSplit.cmdQs.size() + j]->reset();
+        if (!this->subcopySizes.empty()) {
+            this->subcopySizes[setIndex * this->bcsSplit.cmdQs.size() + j] = 0u;
+            this->subcopyCmdQs[setIndex * this->bcsSplit.cmdQs.size() + j] = nullptr;
+        }
+    }
+}
+
 size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPool) {
     /* Internal events needed for split:
      *  - event per subcopy to signal completion of given subcopy (vector of subcopy events),
@@ -151,12 +367,32 @@ size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPoo
         this->createdFromLatestPool = 0u;
     }
 
+    // Adaptive split reads subcopy durations back to learn per-engine bandwidth, so subcopy events come from a timestamp pool.
+    const size_t subcopyEvents = neededEvents - 2;
+    EventPool *timestampPool = nullptr;
+    if (this->bcsSplit.adaptiveSplit) {
+        if (this->timestampPools.empty() ||
+            this->createdFromLatestTimestampPool + subcopyEvents > maxEventCountInPool) {
+            ze_result_t result;
+            ze_event_pool_desc_t desc{};
+            desc.stype = ZE_STRUCTURE_TYPE_EVENT_POOL_DESC;
+            desc.flags = ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+            desc.count = static_cast<uint32_t>(maxEventCountInPool);
+            auto hDevice = this->bcsSplit.device.toHandle();
+            this->timestampPools.push_back(EventPool::create(this->bcsSplit.device.getDriverHandle(), context, 1, &hDevice, &desc, result));
+            this->createdFromLatestTimestampPool = 0u;
+        }
+        timestampPool = this->timestampPools[this->timestampPools.size() - 1];
+    }
+
     auto pool = this->pools[this->pools.size() - 1];
     ze_event_desc_t desc{};
     desc.stype = ZE_STRUCTURE_TYPE_EVENT_DESC;
     desc.signal = ZE_EVENT_SCOPE_FLAG_DEVICE;
     for (size_t i = 0; i < neededEvents; i++) {
-        desc.index = static_cast<uint32_t>(this->createdFromLatestPool++);
+        auto eventPool = (timestampPool && i < subcopyEvents) ? timestampPool : pool;
+        auto &createdFromEventPool = (eventPool == timestampPool) ? this->createdFromLatestTimestampPool : this->createdFromLatestPool;
+        desc.index = static_cast<uint32_t>(createdFromEventPool++);
 
         // Marker event is the only one of internal split events that will be read from host, so create it at the end with appended scope flag.
         if (i == neededEvents - 1) {
@@ -164,7 +400,7 @@ size_t BcsSplit::Events::allocateNew(Context *context, size_t maxEventCountInPoo
         }
 
         ze_event_handle_t hEvent{};
-        pool->createEvent(&desc, &hEvent);
+        eventPool->createEvent(&desc, &hEvent);
         Event::fromHandle(hEvent)->disableImplicitCounterBasedMode();
 
         // Last event, created with host scope flag, is marker event.
@@ -198,5 +434,14 @@ void BcsSplit::Events::releaseResources() {
         pool->destroy();
     }
     pools.clear();
+    for (auto &pool : this->timestampPools) {
+        pool->destroy();
+    }
+    timestampPools.clear();
+    for (auto &inUse : this->setInUse) {
+        inUse.store(false, std::memory_order_relaxed);
+    }
+    publishedSets.store(0u, std::memory_order_relaxed);
+    nextSetHint.store(0u, std::memory_order_relaxed);
 }
 } // namespace L0
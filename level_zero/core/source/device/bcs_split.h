@@ -16,6 +16,8 @@
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/event/event.h"
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <vector>
@@ -29,23 +31,47 @@ struct CommandQueue;
 struct DeviceImp;
 
 struct BcsSplit {
+    static constexpr size_t minAdaptiveSplitSize = MemoryConstants::megaByte;
+    static constexpr size_t maxAdaptiveSplitSize = 16 * MemoryConstants::megaByte;
+    static constexpr size_t defaultAdaptiveSplitSize = 4 * MemoryConstants::megaByte;
+    static constexpr double busyEngineWeightRatio = 0.25;
+    static constexpr double bandwidthWeight = 0.25;
+    static constexpr uint64_t singleEngineProbePeriod = 16;
+
     DeviceImp &device;
     uint32_t clientCount = 0u;
+    bool adaptiveSplit = false;
 
     std::mutex mtx;
 
     struct Events {
+        static constexpr size_t maxLockFreeEventSets = 128;
+
         BcsSplit &bcsSplit;
 
         std::mutex mtx;
         std::vector<EventPool *> pools;
+        std::vector<EventPool *> timestampPools;
         std::vector<Event *> barrier;
         std::vector<Event *> subcopy;
         std::vector<Event *> marker;
         size_t createdFromLatestPool = 0u;
+        size_t createdFromLatestTimestampPool = 0u;
+
+        // Adaptive split only: event sets are claimed with a CAS on setInUse, storage is reserved upfront
+        // so that sets below publishedSets can be read without taking mtx.
+        std::array<std::atomic<bool>, maxLockFreeEventSets> setInUse{};
+        std::atomic<size_t> publishedSets{0u};
+        std::atomic<size_t> nextSetHint{0u};
+        std::vector<size_t> subcopySizes;
+        std::vector<CommandQueue *> subcopyCmdQs;
 
         size_t obtainForSplit(Context *context, size_t maxEventCountInPool);
+        size_t obtainForSplitLockFree(Context *context, size_t maxEventCountInPool);
+        size_t waitForPendingSet();
         size_t allocateNew(Context *context, size_t maxEventCountInPool);
+        void resetSet(size_t setIndex);
+        void releaseSet(size_t setIndex) { setInUse[setIndex].store(false, std::memory_order_release); }
 
         void releaseResources();
 
@@ -60,6 +86,11 @@ struct BcsSplit {
     NEO::BcsInfoMask h2dEngines = NEO::EngineHelpers::h2dCopyEngineMask;
     NEO::BcsInfoMask d2hEngines = NEO::EngineHelpers::d2hCopyEngineMask;
 
+    std::vector<std::atomic<double>> engineBytesPerNs;
+    std::atomic<double> singleEngineBytesPerNs{0.0};
+    std::atomic<uint64_t> adaptiveSplitsCount{0u};
+    std::atomic<size_t> adaptiveMinimalSplitSize{defaultAdaptiveSplitSize};
+
     template <GFXCORE_FAMILY gfxCoreFamily, typename T, typename K>
     ze_result_t appendSplitCall(CommandListCoreFamilyImmediate<gfxCoreFamily> *cmdList,
                                 T dstptr,
@@ -74,7 +105,17 @@ struct BcsSplit {
                                 std::function<ze_result_t(T, K, size_t, ze_event_handle_t)> appendCall) {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
-        auto markerEventIndex = this->events.obtainForSplit(Context::fromHandle(cmdList->getCmdListContext()), MemoryConstants::pageSize64k / sizeof(typename CommandListCoreFamilyImmediate<gfxCoreFamily>::GfxFamily::TimestampPacketType));
+        auto signalEvent = Event::fromHandle(hSignalEvent);
+
+        // validated before an event set is obtained, the set's marker is reset and would never signal again
+        if (!cmdList->handleCounterBasedEventOperations(signalEvent)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+
+        auto context = Context::fromHandle(cmdList->getCmdListContext());
+        auto maxEventCountInPool = MemoryConstants::pageSize64k / sizeof(typename CommandListCoreFamilyImmediate<gfxCoreFamily>::GfxFamily::TimestampPacketType);
+        auto markerEventIndex = this->adaptiveSplit ? this->events.obtainForSplitLockFree(context, maxEventCountInPool)
+                                                    : this->events.obtainForSplit(context, maxEventCountInPool);
 
         auto barrierRequired = !cmdList->isInOrderExecutionEnabled() && cmdList->isBarrierRequired();
         if (barrierRequired) {
@@ -86,15 +127,20 @@ struct BcsSplit {
 
         auto &cmdQsForSplit = this->getCmdQsForSplit(direction);
 
-        auto signalEvent = Event::fromHandle(hSignalEvent);
-
-        if (!cmdList->handleCounterBasedEventOperations(signalEvent)) {
-            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        StackVec<size_t, 4> chunkSizes;
+        if (this->adaptiveSplit) {
+            chunkSizes = this->getAdaptiveChunkSizes(cmdQsForSplit, size);
         }
 
         auto totalSize = size;
         auto engineCount = cmdQsForSplit.size();
         for (size_t i = 0; i < cmdQsForSplit.size(); i++) {
+            auto localSize = this->adaptiveSplit ? chunkSizes[i] : totalSize / engineCount;
+            if (localSize == 0u) {
+                engineCount--;
+                continue;
+            }
+
             if (barrierRequired) {
                 auto barrierEventHandle = this->events.barrier[markerEventIndex]->toHandle();
                 cmdList->addEventsToCmdList(1u, &barrierEventHandle, hasRelaxedOrderingDependencies, false, true);
@@ -102,11 +148,10 @@ struct BcsSplit {
 
             cmdList->addEventsToCmdList(numWaitEvents, phWaitEvents, hasRelaxedOrderingDependencies, false, true);
 
-            if (signalEvent && i == 0u) {
+            if (signalEvent && eventHandles.empty()) {
                 cmdList->appendEventForProfilingAllWalkers(signalEvent, true, true);
             }
 
-            auto localSize = totalSize / engineCount;
             auto localDstPtr = ptrOffset(dstptr, size - totalSize);
             auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
 
@@ -120,6 +165,10 @@ struct BcsSplit {
             }
 
             eventHandles.push_back(eventHandle);
+            if (this->adaptiveSplit) {
+                this->events.subcopySizes[subcopyEventIndex + i] = localSize;
+                this->events.subcopyCmdQs[subcopyEventIndex + i] = cmdQsForSplit[i];
+            }
 
             totalSize -= localSize;
             engineCount--;
@@ -129,7 +178,7 @@ struct BcsSplit {
             }
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(cmdQsForSplit.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false, true);
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data(), hasRelaxedOrderingDependencies, false, true);
         if (signalEvent) {
             cmdList->appendEventForProfilingAllWalkers(signalEvent, false, true);
         }
@@ -140,9 +189,18 @@ struct BcsSplit {
         }
         cmdList->handleInOrderDependencyCounter(signalEvent, false);
 
+        if (this->adaptiveSplit) {
+            this->events.releaseSet(markerEventIndex);
+        }
+
         return result;
     }
 
+    StackVec<size_t, 4> getAdaptiveChunkSizes(const std::vector<CommandQueue *> &cmdQsForSplit, size_t size);
+    void recordSplitCompletion(size_t setIndex);
+    size_t getEngineIndex(CommandQueue *cmdQ) const;
+    size_t getAdaptiveMinimalSplitSize() const { return adaptiveMinimalSplitSize.load(std::memory_order_relaxed); }
+
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
     std::vector<CommandQueue *> &getCmdQsForSplit(NEO::TransferDirection direction);
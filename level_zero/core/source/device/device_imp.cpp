@@ -9,6 +9,7 @@
 
 #include "shared/source/assert_handler/assert_handler.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/command_container/cmdcontainer.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
@@ -1263,12 +1264,26 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, bool
 
     device->execEnvironment = (void *)neoDevice->getExecutionEnvironment();
     device->allocationsForReuse = std::make_unique<NEO::AllocationsList>();
+    if (NEO::debugManager.flags.SetAmountOfCmdBuffersToPrewarm.get() > 0) {
+        NEO::CommandContainer::prewarmReusableCmdBuffers(*neoDevice, *device->allocationsForReuse,
+                                                         static_cast<uint32_t>(NEO::debugManager.flags.SetAmountOfCmdBuffersToPrewarm.get()));
+    }
     bool platformImplicitScaling = gfxCoreHelper.platformSupportsImplicitScaling(rootDeviceEnvironment);
     device->implicitScalingCapable = NEO::ImplicitScalingHelper::isImplicitScalingEnabled(neoDevice->getDeviceBitfield(), platformImplicitScaling);
     device->metricContext = MetricDeviceContext::create(*device);
     device->builtins = BuiltinFunctionsLib::create(
         device, neoDevice->getBuiltIns());
     device->cacheReservation = CacheReservation::create(*device);
+    // cached imports rely on userptr invalidation done by the kernel, which is not available on WDDM
+    auto hostPtrImportsInvalidatedByKernel = rootDeviceEnvironment.osInterface && rootDeviceEnvironment.osInterface->getDriverModel() &&
+                                             rootDeviceEnvironment.osInterface->getDriverModel()->getDriverModelType() == NEO::DriverModelType::drm;
+    if (NEO::debugManager.flags.EnableHostPtrImportCache.get() == 1 && hostPtrImportsInvalidatedByKernel) {
+        size_t budget = NEO::HostPtrImportCache::defaultBudget;
+        if (NEO::debugManager.flags.HostPtrImportCacheBudgetMB.get() > 0) {
+            budget = static_cast<size_t>(NEO::debugManager.flags.HostPtrImportCacheBudgetMB.get()) * MemoryConstants::megaByte;
+        }
+        device->hostPtrImportCache = std::make_unique<NEO::HostPtrImportCache>(*neoDevice->getMemoryManager(), budget);
+    }
     device->maxNumHwThreads = NEO::GfxCoreHelper::getMaxThreadsForVfe(hwInfo);
 
     auto osInterface = rootDeviceEnvironment.osInterface.get();
@@ -1391,6 +1406,30 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, bool
     return device;
 }
 
+NEO::PrintfOutputWorker *DeviceImp::getPrintfOutputWorker() {
+    std::lock_guard<std::mutex> lock(this->printfOutputWorkerMtx);
+    if (!this->printfOutputWorker) {
+        this->printfOutputWorker = std::make_unique<NEO::PrintfOutputWorker>();
+    }
+    return this->printfOutputWorker.get();
+}
+
+void DeviceImp::drainPrintfOutput() {
+    std::lock_guard<std::mutex> lock(this->printfOutputWorkerMtx);
+    if (this->printfOutputWorker) {
+        this->printfOutputWorker->drain();
+    }
+}
+
+std::shared_ptr<EventArena> DeviceImp::getEventArena(NEO::AllocationType allocationType, uint32_t eventSize, uint32_t eventAlignment) {
+    std::lock_guard<std::mutex> lock(this->eventArenasMtx);
+    auto &eventArena = this->eventArenas[std::make_tuple(allocationType, eventSize, eventAlignment)];
+    if (!eventArena) {
+        eventArena = std::make_shared<EventArena>(this, allocationType, eventSize, eventAlignment);
+    }
+    return eventArena;
+}
+
 void DeviceImp::releaseResources() {
     if (resourcesReleased) {
         return;
@@ -1426,6 +1465,9 @@ void DeviceImp::releaseResources() {
     metricContext.reset();
     builtins.reset();
     cacheReservation.reset();
+    eventArenas.clear();
+    hostPtrImportCache.reset();
+    printfOutputWorker.reset();
 
     if (allocationsForReuse.get()) {
         allocationsForReuse->freeAllGraphicsAllocations(neoDevice);
@@ -1681,6 +1723,38 @@ ze_result_t DeviceImp::getCsrForOrdinalAndIndexWithPriority(NEO::CommandStreamRe
     return getCsrForOrdinalAndIndex(csr, ordinal, index);
 }
 
+NEO::CommandStreamReceiver *DeviceImp::selectLeastBusyCsr(const NEO::EnginesT &engines, uint32_t startIndex) {
+    NEO::CommandStreamReceiver *leastBusyCsr = nullptr;
+    TaskCountType leastOutstandingTasks = std::numeric_limits<TaskCountType>::max();
+
+    auto enginesCount = static_cast<uint32_t>(engines.size());
+    for (uint32_t i = 0; i < enginesCount; i++) {
+        auto csr = engines[(startIndex + i) % enginesCount].commandStreamReceiver;
+        TaskCountType completedTaskCount = *csr->getTagAddress();
+        TaskCountType outstandingTasks = csr->peekTaskCount() > completedTaskCount ? csr->peekTaskCount() - completedTaskCount : 0u;
+        if (outstandingTasks < leastOutstandingTasks) {
+            leastOutstandingTasks = outstandingTasks;
+            leastBusyCsr = csr;
+        }
+    }
+    return leastBusyCsr;
+}
+
+NEO::CommandStreamReceiver *DeviceImp::getLeastBusyCsrForOrdinal(uint32_t ordinal, NEO::CommandStreamReceiver *defaultCsr) {
+    auto &engineGroups = getActiveDevice()->getRegularEngineGroups();
+    if (ordinal >= engineGroups.size() || engineGroups[ordinal].engineGroupType != NEO::EngineGroupType::compute) {
+        return defaultCsr;
+    }
+
+    auto &engines = engineGroups[ordinal].engines;
+    auto defaultCsrInGroup = std::any_of(engines.begin(), engines.end(), [defaultCsr](const NEO::EngineControl &engine) { return engine.commandStreamReceiver == defaultCsr; });
+    if (engines.size() < 2 || !defaultCsrInGroup) {
+        return defaultCsr;
+    }
+
+    return selectLeastBusyCsr(engines, loadBalancingStartIndex.fetch_add(1));
+}
+
 ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     NEO::Device *activeDevice = getActiveDevice();
     if (this->implicitScalingCapable) {
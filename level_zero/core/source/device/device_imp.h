@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,18 +7,24 @@
 
 #pragma once
 
+#include "shared/source/command_stream/transfer_planner.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/topology_map.h"
+#include "shared/source/memory_manager/host_ptr_import_cache.h"
 #include "shared/source/memory_manager/memadvise_flags.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/program/printf_output_worker.h"
 
 #include "level_zero/core/source/device/bcs_split.h"
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/event/event_arena.h"
 
+#include <atomic>
 #include <map>
 #include <mutex>
+#include <tuple>
 
 namespace NEO {
 class AllocationsList;
@@ -114,6 +120,8 @@ struct DeviceImp : public Device, NEO::NonCopyableOrMovableClass {
     ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) override;
     ze_result_t getCsrForOrdinalAndIndexWithPriority(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index, ze_command_queue_priority_t priority) override;
     ze_result_t getCsrForLowPriority(NEO::CommandStreamReceiver **csr) override;
+    NEO::CommandStreamReceiver *getLeastBusyCsrForOrdinal(uint32_t ordinal, NEO::CommandStreamReceiver *defaultCsr);
+    static NEO::CommandStreamReceiver *selectLeastBusyCsr(const NEO::EnginesT &engines, uint32_t startIndex);
     NEO::GraphicsAllocation *obtainReusableAllocation(size_t requiredSize, NEO::AllocationType type) override;
     void storeReusableAllocation(NEO::GraphicsAllocation &alloc) override;
     NEO::Device *getActiveDevice() const;
@@ -138,8 +146,21 @@ struct DeviceImp : public Device, NEO::NonCopyableOrMovableClass {
     Device *rootDevice = nullptr;
 
     std::mutex printfKernelMutex;
+    std::atomic<uint32_t> loadBalancingStartIndex{0};
 
     BcsSplit bcsSplit;
+    NEO::TransferPlanner transferPlanner;
+
+    std::shared_ptr<EventArena> getEventArena(NEO::AllocationType allocationType, uint32_t eventSize, uint32_t eventAlignment);
+    std::map<std::tuple<NEO::AllocationType, uint32_t, uint32_t>, std::shared_ptr<EventArena>> eventArenas;
+    std::mutex eventArenasMtx;
+
+    std::unique_ptr<NEO::HostPtrImportCache> hostPtrImportCache;
+
+    NEO::PrintfOutputWorker *getPrintfOutputWorker();
+    void drainPrintfOutput();
+    std::unique_ptr<NEO::PrintfOutputWorker> printfOutputWorker;
+    std::mutex printfOutputWorkerMtx;
 
     bool resourcesReleased = false;
     bool calculationForDisablingEuFusionWithDpasNeeded = false;
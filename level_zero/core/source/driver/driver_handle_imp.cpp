@@ -503,6 +503,14 @@ void DriverHandleImp::createHostPointerManager() {
 
 ze_result_t DriverHandleImp::importExternalPointer(void *ptr, size_t size) {
     if (hostPointerManager.get() != nullptr) {
+        if (NEO::debugManager.flags.EnableHostPtrImportCache.get() == 1) {
+            for (auto &device : this->devices) {
+                auto hostPtrImportCache = static_cast<DeviceImp *>(device)->hostPtrImportCache.get();
+                if (hostPtrImportCache) {
+                    hostPtrImportCache->invalidateRange(ptr, size);
+                }
+            }
+        }
         auto ret = hostPointerManager->createHostPointerMultiAllocation(this->devices,
                                                                         ptr,
                                                                         size);
@@ -17,6 +17,7 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
@@ -106,6 +107,19 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         allocationType = NEO::AllocationType::gpuTimestampDeviceBuffer;
     }
 
+    if (NEO::debugManager.flags.EnableEventArena.get() == 1 &&
+        this->devices.size() == 1 &&
+        !isIpcPoolFlagSet() &&
+        !isEventPoolKerneMappedTsFlagSet() &&
+        EventArena::isSupported(this->numEvents)) {
+        auto arena = static_cast<DeviceImp *>(devices[0])->getEventArena(allocationType, this->eventSize, this->eventAlignment);
+        if (arena->obtain(this->numEvents, this->arenaBlock)) {
+            this->eventArena = std::move(arena);
+            this->isHostVisibleEventPoolAllocation = !(this->isDeviceEventPoolAllocation && isEventPoolDeviceAllocationFlagSet());
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
 
     bool allocatedMemory = false;
@@ -150,6 +164,9 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 }
 
 EventPool::~EventPool() {
+    if (eventArena) {
+        eventArena->release(arenaBlock);
+    }
     if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
@@ -367,6 +384,37 @@ ze_result_t EventPool::openEventPoolIpcHandle(const ze_ipc_event_pool_handle_t &
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t Event::queryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pResults, bool convertToNs) {
+    static_assert(sizeof(ze_kernel_timestamp_result_t) == 2 * sizeof(ze_kernel_timestamp_data_t) && sizeof(ze_kernel_timestamp_data_t) == 2 * sizeof(uint64_t),
+                  "Kernel timestamp results are converted as a flat array of start/end tick pairs");
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (!Event::fromHandle(phEvents[i])) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    uint32_t firstUnconverted = 0;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvents[i]);
+        auto eventDevice = event->device;
+        if (event->readKernelTimestamp(pResults[i], eventDevice->getGfxCoreHelper().useOnlyGlobalTimestamps()) != ZE_RESULT_SUCCESS) {
+            pResults[i] = {};
+            ret = ZE_RESULT_NOT_READY;
+        }
+
+        // consecutive events of the same device are converted together with that device's timer resolution
+        if (convertToNs && (i + 1 == numEvents || Event::fromHandle(phEvents[i + 1])->device != eventDevice)) {
+            const auto resolution = eventDevice->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+            const auto validBits = eventDevice->getNEODevice()->getHardwareInfo().capabilityTable.kernelTimestampValidBits;
+            NEO::TimestampPacketHelper::convertTicksToNs(reinterpret_cast<uint64_t *>(&pResults[firstUnconverted]), 2u * (i + 1 - firstUnconverted), resolution, validBits);
+            firstUnconverted = i + 1;
+        }
+    }
+    return ret;
+}
+
 ze_result_t Event::destroy() {
     delete this;
     return ZE_RESULT_SUCCESS;
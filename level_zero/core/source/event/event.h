@@ -11,6 +11,7 @@
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/core/source/event/event_arena.h"
 #include <level_zero/ze_api.h>
 
 #include <atomic>
@@ -74,6 +75,7 @@ struct EventDescriptor {
     bool kerneMappedTsPoolFlag = false;
     bool importedIpcPool = false;
     bool ipcPool = false;
+    size_t allocationOffset = 0;
 };
 
 struct Event : _ze_event_handle_t {
@@ -86,6 +88,9 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
     virtual ze_result_t queryKernelTimestampsExt(Device *device, uint32_t *pCount, ze_event_query_kernel_timestamps_results_ext_properties_t *pResults) = 0;
+    virtual ze_result_t readKernelTimestamp(ze_kernel_timestamp_result_t &result, bool onlyGlobalTimestamps) { return queryKernelTimestamp(&result); }
+
+    static ze_result_t queryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pResults, bool convertToNs);
 
     enum State : uint32_t {
         STATE_SIGNALED = 0u,
@@ -359,7 +364,9 @@ struct EventPool : _ze_event_pool_handle_t {
 
     inline ze_event_pool_handle_t toHandle() { return this; }
 
-    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return *eventPoolAllocations; }
+    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return eventArena ? *arenaBlock.allocation : *eventPoolAllocations; }
+    size_t getAllocationOffset() const { return arenaBlock.offset; }
+    bool isAllocatedFromEventArena() const { return eventArena != nullptr; }
 
     uint32_t getEventSize() const { return eventSize; }
     void setEventSize(uint32_t size) { eventSize = size; }
@@ -414,6 +421,8 @@ struct EventPool : _ze_event_pool_handle_t {
 
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
     void *eventPoolPtr = nullptr;
+    std::shared_ptr<EventArena> eventArena;
+    EventArena::Block arenaBlock{};
     ContextImp *context = nullptr;
 
     size_t numEvents = 1;
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_arena.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace L0 {
+
+EventArena::EventArena(Device *device, NEO::AllocationType allocationType, uint32_t eventSize, uint32_t eventAlignment)
+    : device(device), memoryManager(device->getDriverHandle()->getMemoryManager()), allocationType(allocationType), eventSize(eventSize), eventAlignment(eventAlignment) {
+    for (auto &freeList : freeLists) {
+        freeList.store(emptyHead, std::memory_order_relaxed);
+    }
+    for (auto &slab : slabs) {
+        slab.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+EventArena::~EventArena() {
+    for (uint32_t i = 0; i < slabsCount.load(); i++) {
+        auto slab = slabs[i].load();
+        for (auto graphicsAllocation : slab->allocation->getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(graphicsAllocation);
+        }
+        delete slab;
+    }
+}
+
+uint32_t EventArena::getSizeClass(size_t numEvents) {
+    return Math::log2(Math::nextPowerOfTwo(static_cast<uint32_t>(numEvents)));
+}
+
+bool EventArena::obtain(size_t numEvents, Block &block) {
+    if (!isSupported(numEvents)) {
+        return false;
+    }
+    const auto sizeClass = getSizeClass(numEvents);
+
+    while (true) {
+        for (auto currentClass = sizeClass; currentClass < sizeClassesCount; currentClass++) {
+            uint32_t globalEventIndex = 0;
+            if (!pop(currentClass, globalEventIndex)) {
+                continue;
+            }
+            while (currentClass > sizeClass) {
+                currentClass--;
+                push(currentClass, globalEventIndex + (1u << currentClass));
+            }
+
+            auto &slab = getSlab(globalEventIndex);
+            block.allocation = slab.allocation.get();
+            block.offset = static_cast<size_t>(globalEventIndex & (slabEventsCount - 1)) * eventSize;
+            block.firstEventIndex = globalEventIndex;
+            block.sizeClass = sizeClass;
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(growMtx);
+        recycleCompletedBlocks();
+        if (coalesce(sizeClass)) {
+            continue;
+        }
+        if (!addSlab()) {
+            return false;
+        }
+    }
+}
+
+void EventArena::release(const Block &block) {
+    PendingBlock pendingBlock{block.firstEventIndex, block.sizeClass, {}};
+    auto graphicsAllocation = block.allocation->getDefaultGraphicsAllocation();
+    for (auto &engine : memoryManager->getRegisteredEngines(graphicsAllocation->getRootDeviceIndex())) {
+        auto osContextId = engine.osContext->getContextId();
+        auto allocationTaskCount = graphicsAllocation->getTaskCount(osContextId);
+        if (graphicsAllocation->isUsedByOsContext(osContextId) &&
+            allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            pendingBlock.waits.push_back({engine.commandStreamReceiver, allocationTaskCount});
+        }
+    }
+
+    if (pendingBlock.waits.empty()) {
+        push(block.sizeClass, block.firstEventIndex);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(pendingMtx);
+    pendingBlocks.push_back(std::move(pendingBlock));
+    pendingBlocksCount.store(pendingBlocks.size(), std::memory_order_relaxed);
+}
+
+size_t EventArena::getPendingBlocksCount() {
+    std::lock_guard<std::mutex> lock(pendingMtx);
+    return pendingBlocks.size();
+}
+
+void EventArena::recycleCompletedBlocks() {
+    if (pendingBlocksCount.load(std::memory_order_relaxed) == 0u) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(pendingMtx);
+    auto completed = [](const PendingBlock &pendingBlock) {
+        return std::all_of(pendingBlock.waits.begin(), pendingBlock.waits.end(), [](const auto &wait) {
+            return *wait.first->getTagAddress() >= wait.second;
+        });
+    };
+    auto firstPending = std::partition(pendingBlocks.begin(), pendingBlocks.end(), completed);
+    for (auto it = pendingBlocks.begin(); it != firstPending; it++) {
+        push(it->sizeClass, it->globalEventIndex);
+    }
+    pendingBlocks.erase(pendingBlocks.begin(), firstPending);
+    pendingBlocksCount.store(pendingBlocks.size(), std::memory_order_relaxed);
+}
+
+bool EventArena::pop(uint32_t sizeClass, uint32_t &globalEventIndex) {
+    auto &head = freeLists[sizeClass];
+    auto current = head.load(std::memory_order_acquire);
+    while (true) {
+        if (isEmpty(current)) {
+            return false;
+        }
+        auto entry = static_cast<uint32_t>(current);
+        auto index = entry - 1;
+        auto nextEntry = getSlab(index).next[index & (slabEventsCount - 1)].load(std::memory_order_relaxed);
+        auto tag = (current >> 32) + 1;
+        if (head.compare_exchange_weak(current, (tag << 32) | nextEntry, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            globalEventIndex = index;
+            return true;
+        }
+    }
+}
+
+void EventArena::push(uint32_t sizeClass, uint32_t globalEventIndex) {
+    auto &head = freeLists[sizeClass];
+    auto &next = getSlab(globalEventIndex).next[globalEventIndex & (slabEventsCount - 1)];
+    auto current = head.load(std::memory_order_relaxed);
+    while (true) {
+        next.store(static_cast<uint32_t>(current), std::memory_order_relaxed);
+        auto tag = (current >> 32) + 1;
+        if (head.compare_exchange_weak(current, (tag << 32) | (globalEventIndex + 1), std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+bool EventArena::coalesce(uint32_t sizeClass) {
+    // Detach every free list; blocks released meanwhile go to the new lists and wait for the next coalesce.
+    std::array<std::vector<uint32_t>, sizeClassesCount> freeBlocks;
+    for (uint32_t currentClass = 0; currentClass < sizeClassesCount; currentClass++) {
+        auto &head = freeLists[currentClass];
+        auto current = head.load(std::memory_order_acquire);
+        while (!head.compare_exchange_weak(current, (((current >> 32) + 1) << 32) | emptyHead, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        }
+        auto entry = static_cast<uint32_t>(current);
+        while (entry != emptyHead) {
+            auto index = entry - 1;
+            freeBlocks[currentClass].push_back(index);
+            entry = getSlab(index).next[index & (slabEventsCount - 1)].load(std::memory_order_relaxed);
+        }
+    }
+
+    for (uint32_t currentClass = 0; currentClass + 1 < sizeClassesCount; currentClass++) {
+        auto &blocks = freeBlocks[currentClass];
+        std::sort(blocks.begin(), blocks.end());
+        const uint32_t blockEventsCount = 1u << currentClass;
+        size_t keptCount = 0;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            if ((blocks[i] & blockEventsCount) == 0 && i + 1 < blocks.size() && blocks[i + 1] == blocks[i] + blockEventsCount) {
+                freeBlocks[currentClass + 1].push_back(blocks[i]);
+                i++;
+            } else {
+                blocks[keptCount++] = blocks[i];
+            }
+        }
+        blocks.resize(keptCount);
+    }
+
+    bool blockFits = false;
+    for (uint32_t currentClass = 0; currentClass < sizeClassesCount; currentClass++) {
+        for (auto index : freeBlocks[currentClass]) {
+            push(currentClass, index);
+        }
+        blockFits |= currentClass >= sizeClass && !freeBlocks[currentClass].empty();
+    }
+    return blockFits;
+}
+
+bool EventArena::addSlab() {
+    auto slabIndex = slabsCount.load(std::memory_order_relaxed);
+    if (slabIndex >= maxSlabsCount) {
+        return false;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
+    auto slab = std::make_unique<Slab>();
+    slab->allocation = std::make_unique<NEO::MultiGraphicsAllocation>(rootDeviceIndex);
+
+    const size_t slabSize = alignUp<size_t>(static_cast<size_t>(slabEventsCount) * eventSize, MemoryConstants::pageSize64k);
+    if (allocationType == NEO::AllocationType::gpuTimestampDeviceBuffer) {
+        NEO::AllocationProperties allocationProperties{rootDeviceIndex, slabSize, allocationType, neoDevice->getDeviceBitfield()};
+        allocationProperties.alignment = eventAlignment;
+        auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties);
+        if (!graphicsAllocation) {
+            return false;
+        }
+        slab->allocation->addAllocation(graphicsAllocation);
+    } else {
+        NEO::AllocationProperties allocationProperties{rootDeviceIndex, slabSize, allocationType, systemMemoryBitfield};
+        allocationProperties.alignment = eventAlignment;
+        RootDeviceIndicesContainer rootDeviceIndices;
+        rootDeviceIndices.pushUnique(rootDeviceIndex);
+        if (!memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices, allocationProperties, *slab->allocation)) {
+            return false;
+        }
+    }
+    if (neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode()) {
+        slab->allocation->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
+    }
+
+    slabs[slabIndex].store(slab.release(), std::memory_order_release);
+    slabsCount.store(slabIndex + 1, std::memory_order_release);
+    push(sizeClassesCount - 1, slabIndex << slabEventsCountLog2);
+    return true;
+}
+
+} // namespace L0
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class MemoryManager;
+class MultiGraphicsAllocation;
+} // namespace NEO
+
+namespace L0 {
+struct Device;
+
+// Sub-allocates event pool storage from large slabs, so creating and destroying small event pools does not
+// allocate graphics memory. Blocks are power-of-two event ranges kept in lock-free free lists (one per size),
+// larger free blocks are split on demand. When no free block is large enough, free buddies are merged under
+// the grow lock before a new slab is added. Event pools hold the arena, so it outlives its device if needed.
+// A released block whose slab still has GPU work in flight is parked until the engines pass that work, so
+// late writes to events of a destroyed pool never land in a block already handed to a new pool.
+class EventArena {
+  public:
+    static constexpr uint32_t slabEventsCountLog2 = 10;
+    static constexpr uint32_t slabEventsCount = 1u << slabEventsCountLog2;
+    static constexpr uint32_t maxSlabsCount = 64;
+    static constexpr uint32_t sizeClassesCount = slabEventsCountLog2 + 1;
+
+    struct Block {
+        NEO::MultiGraphicsAllocation *allocation = nullptr;
+        size_t offset = 0;
+        uint32_t firstEventIndex = 0;
+        uint32_t sizeClass = 0;
+    };
+
+    EventArena(Device *device, NEO::AllocationType allocationType, uint32_t eventSize, uint32_t eventAlignment);
+    ~EventArena();
+
+    static bool isSupported(size_t numEvents) { return numEvents > 0 && numEvents <= slabEventsCount; }
+    static uint32_t getSizeClass(size_t numEvents);
+
+    bool obtain(size_t numEvents, Block &block);
+    void release(const Block &block);
+
+    uint32_t getSlabsCount() const { return slabsCount.load(std::memory_order_acquire); }
+    size_t getPendingBlocksCount();
+    uint32_t getEventSize() const { return eventSize; }
+
+  protected:
+    struct Slab {
+        std::unique_ptr<NEO::MultiGraphicsAllocation> allocation;
+        std::array<std::atomic<uint32_t>, slabEventsCount> next{};
+    };
+
+    struct PendingBlock {
+        uint32_t globalEventIndex = 0;
+        uint32_t sizeClass = 0;
+        StackVec<std::pair<NEO::CommandStreamReceiver *, NEO::TaskCountType>, 4> waits;
+    };
+
+    // Free list heads store (tag << 32) | (globalEventIndex + 1), the tag protects the CAS loops against ABA.
+    static constexpr uint64_t emptyHead = 0u;
+
+    static bool isEmpty(uint64_t head) { return static_cast<uint32_t>(head) == emptyHead; }
+
+    bool pop(uint32_t sizeClass, uint32_t &globalEventIndex);
+    void push(uint32_t sizeClass, uint32_t globalEventIndex);
+    bool coalesce(uint32_t sizeClass);
+    void recycleCompletedBlocks();
+    bool addSlab();
+    Slab &getSlab(uint32_t globalEventIndex) const { return *slabs[globalEventIndex >> slabEventsCountLog2].load(std::memory_order_acquire); }
+
+    Device *device = nullptr;
+    NEO::MemoryManager *memoryManager = nullptr;
+    NEO::AllocationType allocationType;
+    uint32_t eventSize = 0;
+    uint32_t eventAlignment = 0;
+
+    std::array<std::atomic<uint64_t>, sizeClassesCount> freeLists{};
+    std::array<std::atomic<Slab *>, maxSlabsCount> slabs{};
+    std::atomic<uint32_t> slabsCount{0u};
+    std::mutex growMtx;
+
+    std::vector<PendingBlock> pendingBlocks;
+    std::atomic<size_t> pendingBlocksCount{0u};
+    std::mutex pendingMtx;
+};
+
+} // namespace L0
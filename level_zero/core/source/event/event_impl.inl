@@ -49,7 +49,7 @@ Event *Event::create(const EventDescriptor &eventDescriptor, const ze_event_desc
     }
 
     event->totalEventSize = eventDescriptor.totalEventSize;
-    event->eventPoolOffset = desc->index * event->totalEventSize;
+    event->eventPoolOffset = eventDescriptor.allocationOffset + desc->index * event->totalEventSize;
     event->hostAddress = ptrOffset(baseHostAddress, event->eventPoolOffset);
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
@@ -131,6 +131,7 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
         eventPool->isEventPoolKerneMappedTsFlagSet(), // kerneMappedTsPoolFlag
         eventPool->getImportedIpcPool(),              // importedIpcPool
         eventPool->isIpcPoolFlagSet(),                // ipcPool
+        eventPool->getAllocationOffset(),             // allocationOffset
     };
 
     return Event::create<TagSizeT>(eventDescriptor, desc, device);
@@ -525,8 +526,12 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
     }
 
+    const bool hybridWaitEnabled = NEO::debugManager.flags.EnableHybridEventWait.get() == 1;
+    NEO::WaitUtils::HybridWaitPolicy hybridWaitPolicy(this->csrs[0]->getCompletionTimeEstimator(), timeout);
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
+    bool waitBlocked = false;
     do {
         if (isKmdWaitModeEnabled() && isCounterBased()) {
             ret = waitForUserFence(timeout);
@@ -534,6 +539,11 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             ret = queryStatus();
         }
         if (ret == ZE_RESULT_SUCCESS) {
+            // events found signaled by the first query do not tell how long the GPU work takes
+            if (hybridWaitEnabled && waitBlocked) {
+                auto waitTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+                this->csrs[0]->getCompletionTimeEstimator().update(static_cast<uint64_t>(waitTime));
+            }
             if (this->getKernelWithPrintfDeviceMutex() != nullptr) {
                 std::lock_guard<std::mutex> lock(*this->getKernelWithPrintfDeviceMutex());
                 if (!this->getKernelForPrintf().expired()) {
@@ -547,6 +557,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             }
             return ret;
         }
+        waitBlocked = true;
 
         currentTime = std::chrono::high_resolution_clock::now();
         elapsedTimeSinceGpuHangCheck = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime);
@@ -561,6 +572,11 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             }
         }
 
+        if (hybridWaitEnabled && timeout != 0) {
+            auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+            hybridWaitPolicy.wait(getCompletionFieldHostAddress(), static_cast<uint64_t>(elapsedTime));
+        }
+
         if (timeout == std::numeric_limits<uint64_t>::max()) {
             continue;
         } else if (timeout == 0) {
@@ -615,9 +631,11 @@ void EventImp<TagSizeT>::resetDeviceCompletionData(bool resetAllPackets) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) {
+    return readKernelTimestamp(*dstptr, this->device->getGfxCoreHelper().useOnlyGlobalTimestamps());
+}
 
-    ze_kernel_timestamp_result_t &result = *dstptr;
-
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::readKernelTimestamp(ze_kernel_timestamp_result_t &result, bool onlyGlobalTimestamps) {
     if (queryStatus() != ZE_RESULT_SUCCESS) {
         return ZE_RESULT_NOT_READY;
     }
@@ -625,21 +643,13 @@ ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_
     assignKernelEventCompletionData(hostAddress);
     calculateProfilingData();
 
-    auto eventTsSetFunc = [&](uint64_t &timestampFieldToCopy, uint64_t &timestampFieldForWriting) {
-        memcpy_s(&(timestampFieldForWriting), sizeof(uint64_t), static_cast<void *>(&timestampFieldToCopy), sizeof(uint64_t));
-    };
-
-    auto &gfxCoreHelper = this->device->getGfxCoreHelper();
-    if (!gfxCoreHelper.useOnlyGlobalTimestamps()) {
-        eventTsSetFunc(contextStartTS, result.context.kernelStart);
-        eventTsSetFunc(globalStartTS, result.global.kernelStart);
-        eventTsSetFunc(contextEndTS, result.context.kernelEnd);
-        eventTsSetFunc(globalEndTS, result.global.kernelEnd);
+    result.global.kernelStart = globalStartTS;
+    result.global.kernelEnd = globalEndTS;
+    if (!onlyGlobalTimestamps) {
+        result.context.kernelStart = contextStartTS;
+        result.context.kernelEnd = contextEndTS;
     } else {
-        eventTsSetFunc(globalStartTS, result.context.kernelStart);
-        eventTsSetFunc(globalStartTS, result.global.kernelStart);
-        eventTsSetFunc(globalEndTS, result.context.kernelEnd);
-        eventTsSetFunc(globalEndTS, result.global.kernelEnd);
+        result.context = result.global;
     }
     return ZE_RESULT_SUCCESS;
 }
@@ -8,6 +8,9 @@
 #include "level_zero/core/source/fence/fence.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/completion_monitor.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 
@@ -61,6 +64,20 @@ ze_result_t Fence::hostSynchronize(uint64_t timeout) {
         return ZE_RESULT_NOT_READY;
     }
 
+    if (NEO::debugManager.flags.EnableCompletionMonitor.get() == 1 && timeout != 0) {
+        const bool enableTimeout = timeout != std::numeric_limits<uint64_t>::max();
+        const NEO::WaitParams waitParams{false, enableTimeout, enableTimeout ? static_cast<int64_t>(timeout / 1000) : 0};
+        const auto waitStatus = csr->getCompletionMonitor()->waitForTaskCount(waitParams, taskCount);
+        if (waitStatus == NEO::WaitStatus::gpuHang) {
+            cmdQueue->printKernelsPrintfOutput(true);
+            cmdQueue->checkAssert();
+            return ZE_RESULT_ERROR_DEVICE_LOST;
+        }
+        if (waitStatus == NEO::WaitStatus::notReady) {
+            return ZE_RESULT_NOT_READY;
+        }
+    }
+
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
     do {
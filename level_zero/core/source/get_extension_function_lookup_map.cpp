@@ -26,9 +26,11 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory64);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListAppendLaunchKernelBatch);
 
     addToMap(lookupMap, zexCounterBasedEventCreate);
     addToMap(lookupMap, zexEventGetDeviceAddress);
+    addToMap(lookupMap, zexEventQueryKernelTimestampsBatch);
 #undef addToMap
 
     return lookupMap;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@ namespace NEO {
 class Device;
 struct KernelInfo;
 class MemoryManager;
+class PrintfFormatCache;
 } // namespace NEO
 
 namespace L0 {
@@ -72,6 +73,8 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    NEO::PrintfFormatCache *getPrintfFormatCache() const { return printfFormatCache.get(); }
+
     void setIsaCopiedToAllocation() {
         isaCopiedToAllocation = true;
     }
@@ -103,6 +106,8 @@ struct KernelImmutableData {
 
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
+    std::unique_ptr<NEO::PrintfFormatCache> printfFormatCache;
+
     bool isaCopiedToAllocation = false;
 };
 
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_container/encode_surface_state.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/cache_policy.h"
@@ -121,6 +122,31 @@ struct KernelHw : public KernelImp {
         args.implicitScaling = device->isImplicitScalingCapable();
         args.isDebuggerActive = isDebuggerActive;
 
+        std::unique_lock<std::mutex> surfaceStateReuseLock;
+        if (isBindlessOffsetSet[argIndex] && NEO::debugManager.flags.EnableBindlessSurfaceStateReuse.get() == 1) {
+            surfaceStateReuseLock = neoDevice->getBindlessHeapsHelper()->obtainSurfaceStateReuseLock();
+
+            NEO::BindlessSurfaceStateKey key;
+            key.gpuAddress = args.graphicsAddress;
+            key.size = args.size;
+            key.mocs = args.mocs;
+            key.numAvailableDevices = args.numAvailableDevices;
+            key.useGlobalAtomics = args.useGlobalAtomics;
+            key.implicitScaling = args.implicitScaling;
+            key.isDebuggerActive = args.isDebuggerActive;
+            key.valid = true;
+
+            if (alloc->getBindlessSurfaceStateKey() == key) {
+                neoDevice->getBindlessHeapsHelper()->incrementReusedSurfaceStatesCount();
+                return;
+            }
+            NEO::EncodeSurfaceState<GfxFamily>::encodeBuffer(args);
+            UNRECOVERABLE_IF(surfaceStateAddress == nullptr);
+            *reinterpret_cast<typename GfxFamily::RENDER_SURFACE_STATE *>(surfaceStateAddress) = surfaceState;
+            alloc->setBindlessSurfaceStateKey(key);
+            return;
+        }
+
         NEO::EncodeSurfaceState<GfxFamily>::encodeBuffer(args);
         UNRECOVERABLE_IF(surfaceStateAddress == nullptr);
         *reinterpret_cast<typename GfxFamily::RENDER_SURFACE_STATE *>(surfaceStateAddress) = surfaceState;
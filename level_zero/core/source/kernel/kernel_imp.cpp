@@ -18,6 +18,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/occupancy_work_group_size.h"
 #include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/helpers/ray_tracing_helper.h"
 #include "shared/source/helpers/register_offsets.h"
@@ -32,6 +33,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/program/print_formatter.h"
 #include "shared/source/program/work_size_info.h"
 #include "shared/source/utilities/arrayref.h"
 
@@ -53,7 +55,7 @@
 namespace L0 {
 #include "level_zero/core/source/kernel/patch_with_implicit_surface.inl"
 
-KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device) {}
+KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device), printfFormatCache(std::make_unique<NEO::PrintfFormatCache>()) {}
 
 KernelImmutableData::~KernelImmutableData() {
     if (nullptr != isaGraphicsAllocation) {
@@ -395,14 +397,23 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
 
         if (numChannels > 0) {
             UNRECOVERABLE_IF(3 != numChannels);
-            NEO::generateLocalIDs(
-                perThreadDataForWholeThreadGroup,
-                static_cast<uint16_t>(simdSize),
-                std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
-                                         static_cast<uint16_t>(groupSizeY),
-                                         static_cast<uint16_t>(groupSizeZ)}},
-                std::array<uint8_t, 3>{{0, 1, 2}},
-                false, grfSize, gfxCoreHelper);
+            if (sharedLocalIdsCache) {
+                NEO::SharedLocalIdsCache::Key key{{static_cast<uint16_t>(groupSizeX), static_cast<uint16_t>(groupSizeY), static_cast<uint16_t>(groupSizeZ)},
+                                                  {0, 1, 2},
+                                                  static_cast<uint8_t>(simdSize),
+                                                  static_cast<uint8_t>(grfSize),
+                                                  false};
+                sharedLocalIdsCache->emitLocalIds(key, perThreadDataForWholeThreadGroup, perThreadDataSizeForWholeThreadGroup, gfxCoreHelper);
+            } else {
+                NEO::generateLocalIDs(
+                    perThreadDataForWholeThreadGroup,
+                    static_cast<uint16_t>(simdSize),
+                    std::array<uint16_t, 3>{{static_cast<uint16_t>(groupSizeX),
+                                             static_cast<uint16_t>(groupSizeY),
+                                             static_cast<uint16_t>(groupSizeZ)}},
+                    std::array<uint8_t, 3>{{0, 1, 2}},
+                    false, grfSize, gfxCoreHelper);
+            }
         }
 
         this->perThreadDataSize = perThreadDataSizeForWholeThreadGroup / numThreadsPerThreadGroup;
@@ -432,7 +443,22 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
         return ZE_RESULT_SUCCESS;
     }
 
-    if (NEO::debugManager.flags.EnableComputeWorkSizeND.get()) {
+    if (NEO::debugManager.flags.EnableOccupancyWorkGroupSizeSuggestion.get() == 1) {
+        auto neoDevice = module->getDevice()->getNEODevice();
+        auto occupancyInfo = NEO::OccupancyInfo::create(kernelDescriptor, neoDevice->getRootDeviceEnvironment(), maxWorkGroupSize, this->getSlmTotalSize());
+        if (!NEO::suggestOccupancyWorkGroupSize(occupancyInfo, workItems, dim, retGroupSize)) {
+            const auto device = static_cast<DeviceImp *>(module->getDevice());
+            const auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+            if (occupancyInfo.usedSlmSize > occupancyInfo.slmSizePerDss) {
+                driverHandle->setErrorDescription("Size of SLM (%u) larger than available (%u)\n", this->getSlmTotalSize(), occupancyInfo.slmSizePerDss);
+                PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Size of SLM (%u) larger than available (%u)\n", this->getSlmTotalSize(), occupancyInfo.slmSizePerDss);
+            } else {
+                driverHandle->setErrorDescription("Number of barriers (%u) larger than available (%u)\n", occupancyInfo.barriersCount, occupancyInfo.maxBarrierCount);
+                PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Number of barriers (%u) larger than available (%u)\n", occupancyInfo.barriersCount, occupancyInfo.maxBarrierCount);
+            }
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+    } else if (NEO::debugManager.flags.EnableComputeWorkSizeND.get()) {
         auto usesImages = kernelDescriptor.kernelAttributes.flags.usesImages;
         auto neoDevice = module->getDevice()->getNEODevice();
         const auto &deviceInfo = neoDevice->getDeviceInfo();
@@ -552,30 +578,14 @@ ze_result_t KernelImp::getSourceAttributes(uint32_t *pSize, char **pString) {
 }
 
 ze_result_t KernelImp::setArgImmediate(uint32_t argIndex, size_t argSize, const void *argVal) {
-    if (kernelImmData->getDescriptor().payloadMappings.explicitArgs.size() <= argIndex) {
+    if (argPatchPlan.getArgsCount() <= argIndex) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
-
-    const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex];
-
-    for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
-        if (element.sourceOffset < argSize) {
-            size_t maxBytesToCopy = argSize - element.sourceOffset;
-            size_t bytesToCopy = std::min(static_cast<size_t>(element.size), maxBytesToCopy);
-
-            auto pDst = ptrOffset(crossThreadData.get(), element.offset);
-            if (argVal) {
-                auto pSrc = ptrOffset(argVal, element.sourceOffset);
-                memcpy_s(pDst, element.size, pSrc, bytesToCopy);
-            } else {
-                uint64_t val = 0;
-                memcpy_s(pDst, element.size,
-                         reinterpret_cast<void *>(&val), bytesToCopy);
-            }
-        } else {
-            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
-        }
+    if (false == argPatchPlan.isArgSizeSufficient(argIndex, argSize)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+
+    argPatchPlan.patchValue(argIndex, ArrayRef<uint8_t>(crossThreadData.get(), crossThreadDataSize), argSize, argVal);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1024,6 +1034,11 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         }
     }
 
+    argPatchPlan.build(kernelDescriptor);
+    if (NEO::debugManager.flags.EnableSharedLocalIdsCache.get() == 1) {
+        sharedLocalIdsCache = neoDevice->getSharedLocalIdsCache();
+    }
+
     slmArgSizes.resize(this->kernelArgHandlers.size(), 0);
     kernelArgInfos.resize(this->kernelArgHandlers.size(), {});
     isArgUncached.resize(this->kernelArgHandlers.size(), 0);
@@ -1082,6 +1097,10 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
 
     residencyContainer.resize(this->kernelArgHandlers.size(), nullptr);
 
+    if (NEO::debugManager.flags.EnableDispatchTemplateCache.get() == 1) {
+        this->dispatchTemplateCache = std::make_unique<NEO::DispatchTemplateCache>(4u);
+    }
+
     auto &kernelAttributes = kernelDescriptor.kernelAttributes;
     if ((kernelAttributes.perHwThreadPrivateMemorySize != 0U) && (false == module->shouldAllocatePrivateMemoryPerDispatch())) {
         this->privateMemoryGraphicsAllocation = allocatePrivateMemoryGraphicsAllocation();
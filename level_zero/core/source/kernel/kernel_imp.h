@@ -10,6 +10,9 @@
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_template_cache.h"
+#include "shared/source/kernel/kernel_arg_patch_plan.h"
+#include "shared/source/kernel/shared_local_ids_cache.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -184,6 +187,8 @@ struct KernelImp : Kernel {
 
     NEO::ImplicitArgs *getImplicitArgs() const override { return pImplicitArgs.get(); }
 
+    NEO::DispatchTemplateCache *getDispatchTemplateCache() const override { return dispatchTemplateCache.get(); }
+
     KernelExt *getExtension(uint32_t extensionType);
 
     void getExtendedKernelProperties(ze_base_desc_t *pExtendedProperties);
@@ -207,6 +212,8 @@ struct KernelImp : Kernel {
     typedef ze_result_t (KernelImp::*KernelArgHandler)(uint32_t argIndex, size_t argSize, const void *argVal);
     std::vector<KernelArgInfo> kernelArgInfos;
     std::vector<KernelImp::KernelArgHandler> kernelArgHandlers;
+    NEO::KernelArgPatchPlan argPatchPlan;
+    NEO::SharedLocalIdsCache *sharedLocalIdsCache = nullptr;
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     std::mutex *devicePrintfKernelMutex = nullptr;
@@ -252,6 +259,8 @@ struct KernelImp : Kernel {
 
     std::unique_ptr<KernelExt> pExtension;
 
+    std::unique_ptr<NEO::DispatchTemplateCache> dispatchTemplateCache;
+
     struct SuggestGroupSizeCacheEntry {
         Vec3<size_t> groupSize;
         uint32_t slmArgsTotalSize = 0u;
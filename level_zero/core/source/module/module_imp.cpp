@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -513,6 +513,10 @@ ModuleImp::~ModuleImp() {
             destroyPrintfKernel(kernel->toHandle());
         }
     }
+    // printf output formatted asynchronously refers to format strings owned by the module
+    if (NEO::debugManager.flags.EnableAsyncPrintfOutput.get() == 1) {
+        static_cast<DeviceImp *>(this->device)->drainPrintfOutput();
+    }
     this->kernelImmDatas.clear();
     if (this->kernelsIsaParentRegion) {
         DEBUG_BREAK_IF(this->device->getNEODevice()->getMemoryManager() == nullptr);
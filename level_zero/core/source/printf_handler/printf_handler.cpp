@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_output_worker.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
@@ -68,12 +69,23 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         }
     }
 
-    NEO::PrintFormatter printfFormatter{
-        printfOutputBuffer,
-        printfOutputSize,
-        using32BitGpuPointers,
-        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
-    printfFormatter.printKernelOutput();
+    auto stringsMap = usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr;
+    auto formatCache = kernelData->getPrintfFormatCache();
+
+    if (NEO::debugManager.flags.EnableAsyncPrintfOutput.get() == 1) {
+        // only the written part of the buffer is handed over, printf buffer can be reused right after returning
+        auto usedSize = std::min(*reinterpret_cast<const uint32_t *>(printfOutputBuffer), printfOutputSize);
+        std::shared_ptr<uint8_t[]> printfOutputCopy(new uint8_t[usedSize]);
+        memcpy_s(printfOutputCopy.get(), usedSize, printfOutputBuffer, usedSize);
+
+        static_cast<DeviceImp *>(device)->getPrintfOutputWorker()->enqueue([printfOutputCopy, usedSize, using32BitGpuPointers, stringsMap, formatCache]() {
+            NEO::PrintFormatter printfFormatter{printfOutputCopy.get(), usedSize, using32BitGpuPointers, stringsMap, formatCache};
+            printfFormatter.printKernelOutput();
+        });
+    } else {
+        NEO::PrintFormatter printfFormatter{printfOutputBuffer, printfOutputSize, using32BitGpuPointers, stringsMap, formatCache};
+        printfFormatter.printKernelOutput();
+    }
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
         PrintfHandler::printfSurfaceInitialDataSize;
@@ -38,6 +38,7 @@ template <typename TagSizeT>
 struct WhiteBox<::L0::EventImp<TagSizeT>> : public L0::EventImp<TagSizeT> {
     using BaseClass = ::L0::EventImp<TagSizeT>;
     using BaseClass::csrs;
+    using BaseClass::device;
     using BaseClass::gpuHangCheckPeriod;
     using BaseClass::hostAddress;
     using BaseClass::hostEventSetValueTimestamps;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -150,6 +150,68 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
 }
 
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinsPreloadInBackgroundEnabledWhenCreateBuiltinFunctionsLibThenAllBuiltinsAreLoadedOnce) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::ensureInitCompletion;
+        using BuiltinFunctionsLibImpl::imageBuiltins;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableBuiltinsPreloadInBackground.set(1);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+    EXPECT_FALSE(lib.initAsyncComplete);
+
+    // builtin requested before preload completes is available without waiting for the whole preload
+    auto copyKernel = lib.getFunction(Builtin::copyBufferBytes);
+    EXPECT_NE(nullptr, copyKernel);
+
+    lib.ensureInitCompletion();
+    EXPECT_TRUE(lib.initAsyncComplete);
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
+        EXPECT_NE(nullptr, lib.builtins[builtId]);
+    }
+    auto imagesSupported = device->getNEODevice()->getHardwareInfo().capabilityTable.supportsImages;
+    for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(ImageBuiltin::count); builtId++) {
+        EXPECT_EQ(imagesSupported, nullptr != lib.imageBuiltins[builtId]);
+    }
+    EXPECT_EQ(copyKernel, lib.getFunction(Builtin::copyBufferBytes));
+
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenBuiltinsPreloadInBackgroundAndDebugMessagesEnabledWhenPreloadCompletesThenPreloadTimeIsPrintedToStderr) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::ensureInitCompletion;
+    };
+
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableBuiltinsPreloadInBackground.set(1);
+    NEO::debugManager.flags.PrintDebugMessages.set(1);
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+
+    ::testing::internal::CaptureStdout();
+    ::testing::internal::CaptureStderr();
+    {
+        MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+        lib.ensureInitCompletion();
+    }
+    auto stdoutOutput = ::testing::internal::GetCapturedStdout();
+    auto stderrOutput = ::testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(std::string::npos, stdoutOutput.find("Builtins preloaded in"));
+    EXPECT_NE(std::string::npos, stderrOutput.find("Builtins preloaded in"));
+
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+}
+
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenCompilerInterfaceWhenCreateDeviceAndImageSupportedThenBuiltinsImageFunctionsAreLoaded) {
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->compilerInterface.reset(new NEO::MockCompilerInterfaceSpirv());
@@ -8,6 +8,7 @@
 #include "shared/source/command_container/encode_surface_state.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/memory_manager/host_ptr_import_cache.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
@@ -1499,6 +1500,34 @@ HWTEST2_F(CommandListCreateWithBcs, givenHostPtrAllocAllocAndImmediateCmdListWhe
     EXPECT_EQ(1u, commandList->csr->getInternalAllocationStorage()->getTemporaryAllocations().peekHead()->hostPtrTaskCountAssignment);
 }
 
+HWTEST2_F(CommandListCreateWithBcs, givenHostPtrImportCacheAndImmediateCmdListWhenExternalMemCreatedThenAllocIsCachedAndReusedForLaterCopies, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableHostPtrImportCache.set(1);
+
+    auto myDevice = std::make_unique<MyDeviceMock<NEO::AllocationType::externalHostPtr>>(device->getNEODevice(), execEnv);
+    myDevice->neoDevice = device->getNEODevice();
+    myDevice->hostPtrImportCache = std::make_unique<NEO::HostPtrImportCache>(*driverHandle->getMemoryManager(), NEO::HostPtrImportCache::defaultBudget);
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>>();
+    commandList->initialize(myDevice.get(), NEO::EngineGroupType::copy, 0u);
+    commandList->cmdListType = CommandList::CommandListType::typeImmediate;
+    commandList->csr = neoDevice->getInternalEngine().commandStreamReceiver;
+    auto buffer = std::make_unique<uint8_t[]>(0x100);
+
+    auto alloc = commandList->getHostPtrAlloc(buffer.get(), 0x100, true);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_TRUE(commandList->csr->getInternalAllocationStorage()->getTemporaryAllocations().peekIsEmpty());
+    EXPECT_EQ(1u, myDevice->hostPtrImportCache->getEntriesCount());
+    EXPECT_EQ(1u, alloc->hostPtrTaskCountAssignment);
+
+    EXPECT_EQ(alloc, commandList->getHostPtrAlloc(&buffer[0x10], 0x80, true));
+    EXPECT_EQ(1u, myDevice->hostPtrImportCache->getEntriesCount());
+    EXPECT_EQ(1u, alloc->hostPtrTaskCountAssignment);
+    EXPECT_TRUE(commandList->csr->getInternalAllocationStorage()->getTemporaryAllocations().peekIsEmpty());
+
+    alloc->hostPtrTaskCountAssignment = 0;
+    myDevice->hostPtrImportCache.reset();
+}
+
 HWTEST2_F(CommandListCreate, givenGetAlignedAllocationWhenInternalMemWithinDifferentAllocThenReturnNewAlloc, IsAtLeastSkl) {
     auto myDevice = std::make_unique<MyDeviceMock<NEO::AllocationType::internalHostMemory>>(device->getNEODevice(), execEnv);
     myDevice->neoDevice = device->getNEODevice();
@@ -14,6 +14,7 @@
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/event/event_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
@@ -197,6 +198,48 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrW
     EXPECT_TRUE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenSyncCopyOnlyImmediateCommandListAndNonUsmHostPtrWhenStagingTransfersEnabledThenStagingTransferIsPreferredOnlyWithoutEvents, IsAtLeastSkl) {
+    debugManager.flags.StagingTransferChunkSize.set(static_cast<int32_t>(MemoryConstants::pageSize64k));
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::copy, 0u);
+    cmdList.isSyncModeQueue = true;
+
+    CpuMemCopyInfo cpuMemCopyInfo(devicePtr, nonUsmHostPtr, sz);
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, sz, cpuMemCopyInfo.dstAllocData);
+    ASSERT_NE(nullptr, cpuMemCopyInfo.dstAllocData);
+    EXPECT_FALSE(cmdList.preferStagingTransfer(cpuMemCopyInfo, nullptr, 0u));
+
+    debugManager.flags.EnableStagingTransfers.set(1);
+    EXPECT_TRUE(cmdList.preferStagingTransfer(cpuMemCopyInfo, nullptr, 0u));
+    EXPECT_FALSE(cmdList.preferStagingTransfer(cpuMemCopyInfo, nullptr, 1u));
+
+    auto signalEvent = reinterpret_cast<ze_event_handle_t>(0x1234);
+    EXPECT_FALSE(cmdList.preferStagingTransfer(cpuMemCopyInfo, signalEvent, 0u));
+
+    CpuMemCopyInfo smallCopyInfo(devicePtr, nonUsmHostPtr, MemoryConstants::pageSize64k);
+    smallCopyInfo.dstAllocData = cpuMemCopyInfo.dstAllocData;
+    EXPECT_FALSE(cmdList.preferStagingTransfer(smallCopyInfo, nullptr, 0u));
+
+    cmdList.isSyncModeQueue = false;
+    EXPECT_FALSE(cmdList.preferStagingTransfer(cpuMemCopyInfo, nullptr, 0u));
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenTransferPlannerEnabledWhenCpuCopiesAreObservedAsSlowThenPreferCopyThroughLockedPtrSwitchesToGpuCopy, IsAtLeastSkl) {
+    debugManager.flags.EnableTransferPlanner.set(1);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = true;
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    CpuMemCopyInfo cpuMemCopyInfo(devicePtr, nonUsmHostPtr, 1024);
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, 1024, cpuMemCopyInfo.dstAllocData);
+    EXPECT_TRUE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
+
+    auto &transferPlanner = static_cast<DeviceImp *>(device)->transferPlanner;
+    for (uint32_t i = 0; i < 64; i++) {
+        transferPlanner.recordTransfer(NEO::TransferPath::cpu, cmdList.getTransferDirection(cpuMemCopyInfo), 1024, 10'000'000u);
+    }
+    EXPECT_FALSE(cmdList.preferCopyThroughLockedPtr(cpuMemCopyInfo, 0, nullptr));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndUsmHostPtrWhenPreferCopyThroughLockedPtrCalledForH2DThenReturnTrue, IsAtLeastSkl) {
     MockCommandListImmediateHw<gfxCoreFamily> cmdList;
     cmdList.copyThroughLockedPtrEnabled = true;
@@ -1087,6 +1130,39 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndCpuMemcpyWithD
     EXPECT_EQ(cmdList.synchronizeEventListCalled, 0u);
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenTransferPlannerEnabledAndSyncImmediateCommandListWhenGpuCopyWaitsForEventsThenTransferIsNotRecorded, IsAtLeastSkl) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableTransferPlanner.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    auto mockCmdQ = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getInternalEngine().commandStreamReceiver, &desc);
+
+    MockAppendMemoryLockedCopyTestImmediateCmdList<gfxCoreFamily> cmdList;
+    cmdList.copyThroughLockedPtrEnabled = false;
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+    cmdList.cmdQImmediate = mockCmdQ.get();
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.isSyncModeQueue = true;
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 1;
+    ze_event_desc_t eventDesc = {};
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto event = std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    auto waitEvent = event->toHandle();
+
+    auto &transferPlanner = static_cast<DeviceImp *>(device)->transferPlanner;
+    auto observationsCount = transferPlanner.getObservationsCount();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 1, &waitEvent, false, false));
+    EXPECT_EQ(observationsCount, transferPlanner.getObservationsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr, false, false));
+    EXPECT_EQ(observationsCount + 1, transferPlanner.getObservationsCount());
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndCpuMemcpyWithDependencyWithinThresholdThenWaitOnHost, IsAtLeastSkl) {
     DebugManagerStateRestore restore;
 
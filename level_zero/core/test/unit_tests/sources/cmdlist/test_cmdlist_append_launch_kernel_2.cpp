@@ -464,6 +464,40 @@ HWTEST_F(CommandListAppendLaunchKernelSWTags, givenEnableSWTagsWhenAppendLaunchK
     EXPECT_TRUE(tagFound);
 }
 
+HWTEST_F(CommandListAppendLaunchKernelSWTags, givenEnableSWTagsWhenAppendLaunchKernelBatchThenCallNameTagsAreInsertedOncePerBatch) {
+    using MI_NOOP = typename FamilyType::MI_NOOP;
+
+    createKernel();
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    auto cmdStream = commandList->getCmdContainer().getCommandStream();
+
+    const zex_kernel_launch_desc_t launches[] = {{kernel->toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {kernel->toHandle(), {1, 1, 1}, 0, nullptr}};
+    auto result = commandList->appendLaunchKernelBatch(2, launches, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream->getCpuBase(), 0), cmdStream->getUsed()));
+    auto noops = findAll<MI_NOOP *>(cmdList.begin(), cmdList.end());
+
+    uint32_t callNameBeginTags = 0;
+    uint32_t callNameEndTags = 0;
+    for (auto &it : noops) {
+        auto noop = genCmdCast<MI_NOOP *>(*it);
+        if (!noop->getIdentificationNumberRegisterWriteEnable()) {
+            continue;
+        }
+        if (NEO::SWTags::BaseTag::getMarkerNoopID(SWTags::OpCode::callNameBegin) == noop->getIdentificationNumber()) {
+            callNameBeginTags++;
+        } else if (NEO::SWTags::BaseTag::getMarkerNoopID(SWTags::OpCode::callNameEnd) == noop->getIdentificationNumber()) {
+            callNameEndTags++;
+        }
+    }
+    EXPECT_EQ(1u, callNameBeginTags);
+    EXPECT_EQ(1u, callNameEndTags);
+}
+
 HWTEST_F(CommandListAppendLaunchKernelSWTags, givenEnableSWTagsWhenAppendEventResetIsCalledThenTagsAreInserted) {
     using MI_NOOP = typename FamilyType::MI_NOOP;
 
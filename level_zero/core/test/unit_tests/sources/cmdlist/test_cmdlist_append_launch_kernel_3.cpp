@@ -18,6 +18,7 @@
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/multi_tile_fixture.h"
@@ -26,6 +27,9 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+#include <chrono>
+#include <limits>
+
 namespace L0 {
 namespace ult {
 
@@ -196,6 +200,252 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandListAppendLaunchKernel, givenAppendLaunchMult
     context->freeMem(reinterpret_cast<void *>(numLaunchArgs));
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenKernelBatchWhenAppendedToCommandListThenWalkerIsEncodedForEachLaunch) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    createKernel();
+
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    const zex_kernel_launch_desc_t launches[] = {{kernel->toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {kernel->toHandle(), {2, 2, 2}, 0, nullptr},
+                                                 {kernel->toHandle(), {4, 1, 1}, 0, nullptr}};
+
+    auto result = commandList->appendLaunchKernelBatch(3, launches, nullptr, 0, nullptr, false);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(
+        cmdList, commandList->getCmdContainer().getCommandStream()->getCpuBase(), commandList->getCmdContainer().getCommandStream()->getUsed()));
+    auto walkers = findAll<DefaultWalkerType *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(3u, walkers.size());
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenInvalidArgumentInKernelBatchWhenAppendingThenErrorIsReturnedAndNothingIsEncoded) {
+    createKernel();
+
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_event_desc_t eventDesc = {};
+    auto eventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    auto waitEvent = std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    auto hWaitEvent = waitEvent->toHandle();
+
+    auto otherKernel = createKernelWithName(kernelName);
+    uint32_t argValue = 0;
+    const zex_kernel_arg_t invalidArg = {std::numeric_limits<uint32_t>::max(), sizeof(argValue), &argValue};
+    const zex_kernel_launch_desc_t launches[] = {{otherKernel->toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {kernel->toHandle(), {1, 1, 1}, 1, &invalidArg},
+                                                 {otherKernel->toHandle(), {1, 1, 1}, 0, nullptr}};
+
+    auto usedBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->appendLaunchKernelBatch(3, launches, nullptr, 1, &hWaitEvent, false));
+    EXPECT_EQ(usedBefore, commandList->getCmdContainer().getCommandStream()->getUsed());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendLaunchKernelBatch(commandList->toHandle(), 0, launches, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendLaunchKernelBatch(commandList->toHandle(), 2, nullptr, nullptr, 0, nullptr));
+    const zex_kernel_launch_desc_t nullKernelLaunch = {nullptr, {1, 1, 1}, 0, nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendLaunchKernelBatch(commandList->toHandle(), 1, &nullKernelLaunch, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendLaunchKernelBatch(commandList->toHandle(), 1, &launches[0], nullptr, 0, nullptr));
+}
+
+struct ArgRecordingKernel : public WhiteBox<::L0::KernelImp> {
+    ze_result_t setArgumentValue(uint32_t argIndex, size_t argSize, const void *pArgValue) override {
+        argValue = *reinterpret_cast<const uint32_t *>(pArgValue);
+        return ZE_RESULT_SUCCESS;
+    }
+    uint32_t argValue = 0;
+};
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+struct LaunchArgRecordingCommandList : public WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>> {
+    using BaseClass = WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>;
+
+    ze_result_t appendLaunchKernelWithParams(::L0::Kernel *kernel,
+                                             const ze_group_count_t &threadGroupDimensions,
+                                             ::L0::Event *event,
+                                             const CmdListKernelLaunchParams &launchParams) override {
+        launchArgValues.push_back(static_cast<ArgRecordingKernel *>(kernel)->argValue);
+        return BaseClass::appendLaunchKernelWithParams(kernel, threadGroupDimensions, event, launchParams);
+    }
+
+    std::vector<uint32_t> launchArgValues;
+};
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenKernelLaunchedWithoutArgumentsBeforeLaunchWithArgumentsInBatchWhenAppendingThenEachLaunchUsesArgumentsSetUpToThatLaunch, IsAtLeastSkl) {
+    ze_kernel_desc_t desc = {};
+    desc.pKernelName = kernelName.c_str();
+    ArgRecordingKernel argKernel;
+    argKernel.module = module.get();
+    argKernel.initialize(&desc);
+    argKernel.argValue = 1;
+
+    LaunchArgRecordingCommandList<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    uint32_t argValues[] = {2, 3};
+    const zex_kernel_arg_t args[] = {{0, sizeof(uint32_t), &argValues[0]},
+                                     {0, sizeof(uint32_t), &argValues[1]}};
+    const zex_kernel_launch_desc_t launches[] = {{argKernel.toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {argKernel.toHandle(), {1, 1, 1}, 1, &args[0]},
+                                                 {argKernel.toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {argKernel.toHandle(), {1, 1, 1}, 1, &args[1]}};
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernelBatch(4, launches, nullptr, 0, nullptr, false));
+    std::vector<uint32_t> expectedLaunchArgValues = {1u, 2u, 2u, 3u};
+    EXPECT_EQ(expectedLaunchArgValues, cmdList.launchArgValues);
+    EXPECT_EQ(3u, argKernel.argValue);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendingKernelBatchThenLaunchesAreSubmittedOnceUnlessCommandBufferRunsOut, IsAtLeastSkl) {
+    createKernel();
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+    cmdList.csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+
+    const zex_kernel_launch_desc_t launches[] = {{kernel->toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {kernel->toHandle(), {1, 1, 1}, 0, nullptr},
+                                                 {kernel->toHandle(), {1, 1, 1}, 0, nullptr}};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernelBatch(3, launches, nullptr, 0, nullptr, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    auto cmdStream = cmdList.commandContainer.getCommandStream();
+    cmdStream->getSpace(cmdStream->getAvailableSpace() - commonImmediateCommandSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernelBatch(3, launches, nullptr, 0, nullptr, false));
+    EXPECT_EQ(3u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenManySmallKernelsWhenAppendedAsBatchToImmediateCommandListThenFewerSubmissionsAreMade, IsAtLeastSkl) {
+    createKernel();
+    constexpr uint32_t numLaunches = 16;
+
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::renderCompute, result));
+    ASSERT_NE(nullptr, commandList);
+    auto csr = commandList->getCsr();
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    auto taskCountBefore = csr->peekTaskCount();
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    auto singleLaunchSubmissions = csr->peekTaskCount() - taskCountBefore;
+
+    std::vector<zex_kernel_launch_desc_t> launches(numLaunches, {kernel->toHandle(), groupCount, 0, nullptr});
+    taskCountBefore = csr->peekTaskCount();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernelBatch(numLaunches, launches.data(), nullptr, 0, nullptr, false));
+    auto batchedLaunchSubmissions = csr->peekTaskCount() - taskCountBefore;
+
+    EXPECT_LT(batchedLaunchSubmissions, singleLaunchSubmissions);
+}
+
+using CommandListAppendLaunchKernelBatchBenchmark = Test<ModuleFixture>;
+
+// Records launches per second of single and batched appends to an immediate command list submitting to the ULT CSR.
+HWTEST2_F(CommandListAppendLaunchKernelBatchBenchmark, givenManySmallKernelsWhenAppendedOneByOneAndAsBatchToImmediateCommandListThenLaunchRateIsRecorded, IsAtLeastSkl) {
+    createKernel();
+    constexpr uint32_t numLaunches = 500;
+
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::renderCompute, result));
+    ASSERT_NE(nullptr, commandList);
+
+    auto getLaunchesPerSecond = [](std::chrono::steady_clock::time_point start) {
+        auto elapsedNs = std::max<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(), 1);
+        return static_cast<int>(numLaunches * 1000000000ull / static_cast<uint64_t>(elapsedNs));
+    };
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    }
+    RecordProperty("singleLaunchesPerSecond", getLaunchesPerSecond(start));
+
+    std::vector<zex_kernel_launch_desc_t> launches(numLaunches, {kernel->toHandle(), groupCount, 0, nullptr});
+    start = std::chrono::steady_clock::now();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernelBatch(numLaunches, launches.data(), nullptr, 0, nullptr, false));
+    RecordProperty("batchedLaunchesPerSecond", getLaunchesPerSecond(start));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenSpecializedDispatchEncodersEnabledWhenCommandListIsInitializedThenEncoderWithoutUnusedFeaturesIsSelected, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+
+    WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>> defaultCmdList;
+    defaultCmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    EXPECT_EQ(NEO::EncodeDispatchKernel<FamilyType>::getSpecializedEncode(NEO::EncodeDispatchKernelFeatures::all), defaultCmdList.encodeDispatchKernel);
+
+    debugManager.flags.EnableSpecializedDispatchEncoders.set(1);
+    WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>> specializedCmdList;
+    specializedCmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+    auto expectedFeatures = NEO::EncodeDispatchKernel<FamilyType>::getRequiredEncodeFeatures(specializedCmdList.partitionCount);
+    EXPECT_EQ(NEO::EncodeDispatchKernel<FamilyType>::getSpecializedEncode(expectedFeatures), specializedCmdList.encodeDispatchKernel);
+    EXPECT_EQ(0u, expectedFeatures & NEO::EncodeDispatchKernelFeatures::debugFlags);
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenSpecializedDispatchEncoderWhenAppendingKernelThenSameSizeIsEncodedAsWithGenericEncoder) {
+    DebugManagerStateRestore restorer;
+    createKernel();
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    size_t launchSize[2] = {};
+
+    for (int32_t specialized : {0, 1}) {
+        debugManager.flags.EnableSpecializedDispatchEncoders.set(specialized);
+        ze_result_t returnValue;
+        std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+        ASSERT_NE(nullptr, commandList);
+
+        auto cmdStream = commandList->getCmdContainer().getCommandStream();
+        auto usedBefore = cmdStream->getUsed();
+        ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        launchSize[specialized] = cmdStream->getUsed() - usedBefore;
+    }
+
+    EXPECT_EQ(launchSize[0], launchSize[1]);
+}
+
+using CommandListDispatchEncoderBenchmark = Test<ModuleFixture>;
+
+// Records appendLaunchKernel cost per launch with the generic and the specialized dispatch encoder on mocks.
+HWTEST_F(CommandListDispatchEncoderBenchmark, givenGenericAndSpecializedDispatchEncoderWhenAppendingManyKernelsThenCostPerLaunchIsRecorded) {
+    DebugManagerStateRestore restorer;
+    createKernel();
+    constexpr uint32_t numLaunches = 500;
+
+    ze_group_count_t groupCount = {1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+
+    for (int32_t specialized : {0, 1}) {
+        debugManager.flags.EnableSpecializedDispatchEncoders.set(specialized);
+        ze_result_t returnValue;
+        std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, returnValue, false));
+        ASSERT_NE(nullptr, commandList);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 1; i < numLaunches; i++) {
+            ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        }
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        RecordProperty(specialized ? "specializedEncoderNanosecondsPerLaunch" : "genericEncoderNanosecondsPerLaunch", static_cast<int>(elapsedNs / (numLaunches - 1)));
+    }
+}
+
 HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendingLaunchKernelThenKernelIsExecutedOnImmediateCmdQ, IsAtLeastSkl) {
     createKernel();
 
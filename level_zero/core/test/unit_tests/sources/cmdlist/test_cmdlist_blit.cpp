@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -104,6 +105,35 @@ HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListWhenAppenBlitFillThenCopyBlt
     device->setDriverHandle(driverHandle.get());
 }
 
+HWTEST2_F(AppendMemoryCopy, givenFillPatternReductionEnabledWhenAppendBlitFillWithRepeatedPatternLargerThanMaxThenCopyBltIsProgrammed, MemFillPlatforms) {
+    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+    using XY_COLOR_BLT = typename GfxFamily::XY_COLOR_BLT;
+    DebugManagerStateRestore restorer;
+    MockCommandListForMemFill<gfxCoreFamily> commandList;
+    MockDriverHandle driverHandleMock;
+    NEO::DeviceVector neoDevices;
+    neoDevices.push_back(std::unique_ptr<NEO::Device>(neoDevice));
+    driverHandleMock.initialize(std::move(neoDevices));
+    device->setDriverHandle(&driverHandleMock);
+    commandList.initialize(device, NEO::EngineGroupType::copy, 0u);
+    uint16_t pattern[16] = {};
+    std::fill(std::begin(pattern), std::end(pattern), static_cast<uint16_t>(1));
+    void *ptr = reinterpret_cast<void *>(0x1234);
+
+    auto ret = commandList.appendMemoryFill(ptr, reinterpret_cast<void *>(&pattern), sizeof(pattern), 0x1000, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, ret);
+
+    debugManager.flags.EnableFillPatternReduction.set(1);
+    ret = commandList.appendMemoryFill(ptr, reinterpret_cast<void *>(&pattern), sizeof(pattern), 0x1000, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(
+        cmdList, ptrOffset(commandList.getCmdContainer().getCommandStream()->getCpuBase(), 0), commandList.getCmdContainer().getCommandStream()->getUsed()));
+    auto itor = find<XY_COLOR_BLT *>(cmdList.begin(), cmdList.end());
+    EXPECT_NE(cmdList.end(), itor);
+    device->setDriverHandle(driverHandle.get());
+}
+
 HWTEST2_F(AppendMemoryCopy,
           givenExternalHostPointerAllocationWhenPassedToAppendBlitFillThenProgramDestinationAddressCorrectly,
           IsAtLeastSkl) {
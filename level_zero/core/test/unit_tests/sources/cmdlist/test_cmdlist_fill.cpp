@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -120,6 +120,106 @@ HWTEST2_F(AppendFillTest,
     delete[] ptr;
 }
 
+HWTEST2_F(AppendFillTest,
+          givenGenericFillKernelEnabledWhenAppendMemoryFillWithUnalignedSizeAndPatternSizeIsOneThenDispatchOneKernel, IsAtLeastSkl) {
+    debugManager.flags.EnableGenericFillKernel.set(1);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    int pattern = 0;
+    const size_t size = 1025;
+    uint8_t *ptr = new uint8_t[size];
+    ze_result_t result = commandList->appendMemoryFill(ptr, &pattern, 1, size, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(1u, commandList->usedKernelLaunchParams.numKernelsInSplitLaunch);
+    EXPECT_FALSE(commandList->usedKernelLaunchParams.isKernelSplitOperation);
+    EXPECT_LE(size, commandList->xGroupSizes[0] * commandList->threadGroupDimensions[0].groupCountX * 16);
+    delete[] ptr;
+}
+
+HWTEST2_F(AppendFillTest,
+          givenGenericFillKernelEnabledWhenAppendMemoryFillWithUnalignedSizeAndMultiBytePatternThenDispatchOneKernel, IsAtLeastSkl) {
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    auto result = commandList->appendMemoryFill(dstPtr, pattern, patternSize, allocSize, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(2u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+
+    debugManager.flags.EnableGenericFillKernel.set(1);
+    commandList->numberOfCallsToAppendLaunchKernelWithParams = 0;
+    result = commandList->appendMemoryFill(dstPtr, pattern, patternSize, allocSize, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(1u, commandList->usedKernelLaunchParams.numKernelsInSplitLaunch);
+}
+
+HWTEST2_F(AppendFillTest,
+          givenGenericFillKernelEnabledWhenAppendMemoryFillWithNonPowerOfTwoPatternThenDispatchOneKernelAndAllocatePatternOnce, IsAtLeastSkl) {
+    debugManager.flags.EnableGenericFillKernel.set(1);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    uint8_t oddPattern[3] = {1, 2, 3};
+    auto result = commandList->appendMemoryFill(dstPtr, oddPattern, sizeof(oddPattern), allocSize, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(1u, commandList->patternAllocations.size());
+    EXPECT_LE(allocSize, commandList->xGroupSizes[0] * commandList->threadGroupDimensions[0].groupCountX * 16);
+}
+
+HWTEST2_F(AppendFillTest,
+          givenGenericFillKernelEnabledWhenFillIsLargeThenGenericKernelIsPreferredOnlyForNonPowerOf2Patterns, IsAtLeastSkl) {
+    debugManager.flags.EnableGenericFillKernel.set(1);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    constexpr size_t maxGenericFillSplitSize = WhiteBox<MockCommandList<gfxCoreFamily>>::maxGenericFillSplitSize;
+    constexpr size_t largeFillSize = 4 * MemoryConstants::gigaByte;
+    CmdListFillKernelArguments fillArguments = {};
+    fillArguments.rightRemainingBytes = 1;
+    EXPECT_TRUE(commandList->isGenericFillKernelPreferred(3, largeFillSize + 3, fillArguments));
+    EXPECT_TRUE(commandList->isGenericFillKernelPreferred(96, largeFillSize + 96, fillArguments));
+    EXPECT_TRUE(commandList->isGenericFillKernelPreferred(4, maxGenericFillSplitSize, fillArguments));
+    EXPECT_FALSE(commandList->isGenericFillKernelPreferred(4, maxGenericFillSplitSize + 4, fillArguments));
+}
+
+HWTEST2_F(AppendFillTest,
+          givenFillSizeRequiringMoreWorkItemsThanDispatchableWhenAppendingGenericFillKernelThenInvalidSizeIsReturnedAndNothingIsDispatched, IsAtLeastSkl) {
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+
+    constexpr size_t genericFillBytesPerWorkItem = WhiteBox<MockCommandList<gfxCoreFamily>>::genericFillBytesPerWorkItem;
+    const size_t size = (static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1) * genericFillBytesPerWorkItem;
+    AlignedAllocationData dstAllocation = {};
+    uint8_t oddPattern[3] = {1, 2, 3};
+    CmdListKernelLaunchParams launchParams = {};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, commandList->appendGenericFillKernel(true, dstAllocation, oddPattern, sizeof(oddPattern), size, nullptr, launchParams));
+    EXPECT_EQ(0u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(0u, commandList->patternAllocations.size());
+}
+
+HWTEST2_F(AppendFillTest,
+          givenFillPatternReductionEnabledWhenAppendMemoryFillWithRepeatedBytePatternThenImmediateFillKernelIsDispatched, IsAtLeastSkl) {
+    debugManager.flags.EnableFillPatternReduction.set(1);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::compute, 0u);
+    uint32_t pattern = 0x07070707;
+    const size_t size = 1024 * 1024;
+    uint8_t *ptr = new uint8_t[size];
+    ze_result_t result = commandList->appendMemoryFill(ptr, &pattern, sizeof(pattern), size, nullptr, 0, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+    EXPECT_EQ(0u, commandList->patternAllocations.size());
+    EXPECT_EQ(size, commandList->xGroupSizes[0] * commandList->threadGroupDimensions[0].groupCountX * 16);
+    delete[] ptr;
+}
+
 HWTEST2_F(AppendFillTest,
           givenAppendMemoryFillWithUnalignedSizeWhenPatternSizeIsOneThenDispatchTwoKernels, IsAtLeastSkl) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -4657,6 +4657,31 @@ HWTEST2_F(BcsSplitInOrderCmdListTests, givenImmediateCmdListWhenDispatchingWithR
     EXPECT_TRUE(verifySplit(1));
 }
 
+HWTEST2_F(BcsSplitInOrderCmdListTests, givenAdaptiveBcsSplitAndCounterBasedEventWithIncorrectFlagsWhenAppendingCopyThenErrorIsReturnedAndNoEventSetIsConsumed, IsAtLeastXeHpcCore) {
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+
+    auto immCmdList = createBcsSplitImmCmdList<gfxCoreFamily>();
+    auto &bcsSplit = static_cast<DeviceImp *>(device)->bcsSplit;
+    ASSERT_TRUE(bcsSplit.adaptiveSplit);
+
+    auto eventPool = createEvents<FamilyType>(1, true);
+    auto eventHandle = events[0]->toHandle();
+    constexpr size_t copySize = 8 * MemoryConstants::megaByte;
+
+    uint32_t copyData[64] = {};
+
+    events[0]->counterBasedFlags = ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_NON_IMMEDIATE;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, immCmdList->appendMemoryCopy(&copyData, &copyData, copySize, eventHandle, 0, nullptr, false, false));
+    EXPECT_EQ(0u, bcsSplit.events.marker.size());
+    EXPECT_EQ(0u, bcsSplit.events.publishedSets.load());
+    EXPECT_TRUE(verifySplit(0));
+
+    events[0]->counterBasedFlags = ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendMemoryCopy(&copyData, &copyData, copySize, eventHandle, 0, nullptr, false, false));
+    EXPECT_EQ(1u, bcsSplit.events.marker.size());
+    EXPECT_FALSE(bcsSplit.events.setInUse[0].load());
+}
+
 using InOrderRegularCmdListTests = InOrderCmdListTests;
 
 HWTEST2_F(InOrderRegularCmdListTests, givenInOrderFlagWhenCreatingCmdListThenEnableInOrderMode, IsAtLeastSkl) {
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/memory_manager/host_ptr_import_cache.h"
+#include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_driver_model.h"
+
+#include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+
+#include "gtest/gtest.h"
+
+namespace L0 {
+namespace ult {
+
+struct HostPtrImportCacheDeviceTest : public ::testing::Test {
+    std::unique_ptr<L0::Device> createDevice(std::unique_ptr<NEO::DriverModel> driverModel) {
+        auto neoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(NEO::defaultHwInfo.get(), 0);
+        if (driverModel) {
+            neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface.reset(new NEO::OSInterface());
+            neoDevice->executionEnvironment->rootDeviceEnvironments[0]->osInterface->setDriverModel(std::move(driverModel));
+        }
+        ze_result_t returnValue = ZE_RESULT_SUCCESS;
+        auto device = std::unique_ptr<L0::Device>(Device::create(driverHandle.get(), neoDevice, false, &returnValue));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+        return device;
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<DriverHandleImp> driverHandle = std::make_unique<DriverHandleImp>();
+};
+
+TEST_F(HostPtrImportCacheDeviceTest, givenHostPtrImportCacheEnabledAndDrmDriverModelWhenCreatingDeviceThenCacheIsCreated) {
+    debugManager.flags.EnableHostPtrImportCache.set(1);
+    debugManager.flags.HostPtrImportCacheBudgetMB.set(16);
+
+    auto device = createDevice(std::make_unique<NEO::MockDriverModelDRM>());
+    ASSERT_NE(nullptr, device);
+    auto hostPtrImportCache = static_cast<DeviceImp *>(device.get())->hostPtrImportCache.get();
+    ASSERT_NE(nullptr, hostPtrImportCache);
+    EXPECT_EQ(16 * MemoryConstants::megaByte, hostPtrImportCache->getBudget());
+}
+
+TEST_F(HostPtrImportCacheDeviceTest, givenHostPtrImportCacheEnabledAndNoKernelUserptrInvalidationWhenCreatingDeviceThenCacheIsNotCreated) {
+    debugManager.flags.EnableHostPtrImportCache.set(1);
+
+    auto device = createDevice(std::make_unique<NEO::MockDriverModelWDDM>());
+    ASSERT_NE(nullptr, device);
+    EXPECT_EQ(nullptr, static_cast<DeviceImp *>(device.get())->hostPtrImportCache);
+
+    device = createDevice(nullptr);
+    ASSERT_NE(nullptr, device);
+    EXPECT_EQ(nullptr, static_cast<DeviceImp *>(device.get())->hostPtrImportCache);
+}
+
+TEST_F(HostPtrImportCacheDeviceTest, givenHostPtrImportCacheNotEnabledAndDrmDriverModelWhenCreatingDeviceThenCacheIsNotCreated) {
+    auto device = createDevice(std::make_unique<NEO::MockDriverModelDRM>());
+    ASSERT_NE(nullptr, device);
+    EXPECT_EQ(nullptr, static_cast<DeviceImp *>(device.get())->hostPtrImportCache);
+}
+
+} // namespace ult
+} // namespace L0
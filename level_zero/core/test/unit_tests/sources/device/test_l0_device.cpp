@@ -27,6 +27,7 @@
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_os_context.h"
 #include "shared/test/common/mocks/mock_sip.h"
@@ -82,6 +83,134 @@ TEST(L0DeviceTest, givenNonExistingFclWhenCreatingDeviceThenCompilerInterfaceIsC
     ASSERT_NE(nullptr, compilerInterface);
 }
 
+TEST(L0DeviceTest, givenSetAmountOfCmdBuffersToPrewarmWhenCreatingDeviceThenCommandBuffersArePlacedInReusableAllocationList) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.SetAmountOfCmdBuffersToPrewarm.set(2);
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    std::unique_ptr<DriverHandleImp> driverHandle(new DriverHandleImp);
+    auto hwInfo = *NEO::defaultHwInfo;
+    auto neoDevice = std::unique_ptr<NEO::Device>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+
+    auto device = std::unique_ptr<L0::Device>(Device::create(driverHandle.get(), neoDevice.release(), false, &returnValue));
+    ASSERT_NE(nullptr, device);
+    auto deviceImp = static_cast<DeviceImp *>(device.get());
+
+    auto firstCmdBuffer = deviceImp->allocationsForReuse->detachAllocation(0u, nullptr, nullptr, NEO::AllocationType::commandBuffer);
+    auto secondCmdBuffer = deviceImp->allocationsForReuse->detachAllocation(0u, nullptr, nullptr, NEO::AllocationType::commandBuffer);
+    EXPECT_NE(nullptr, firstCmdBuffer);
+    EXPECT_NE(nullptr, secondCmdBuffer);
+    EXPECT_EQ(nullptr, deviceImp->allocationsForReuse->detachAllocation(0u, nullptr, nullptr, NEO::AllocationType::commandBuffer));
+
+    device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(firstCmdBuffer.release());
+    device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(secondCmdBuffer.release());
+}
+
+struct LeastBusyCsrSelectionTest : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment.prepareRootDeviceEnvironments(1);
+        executionEnvironment.initializeMemoryManager();
+        for (uint32_t i = 0; i < enginesCount; i++) {
+            osContexts[i].reset(OsContext::create(nullptr, 0, i,
+                                                  EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                               PreemptionMode::ThreadGroup, deviceBitfield)));
+            csrs[i] = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, deviceBitfield);
+            csrs[i]->setupContext(*osContexts[i]);
+            csrs[i]->initializeTagAllocation();
+            *csrs[i]->tagAddress = 0u;
+            csrs[i]->taskCount.store(0u);
+            engines.push_back({csrs[i].get(), osContexts[i].get()});
+        }
+    }
+
+    void setLoad(uint32_t engineIndex, TaskCountType submitted, TaskCountType completed) {
+        csrs[engineIndex]->taskCount.store(submitted);
+        *csrs[engineIndex]->tagAddress = completed;
+    }
+
+    static constexpr uint32_t enginesCount = 4;
+    DeviceBitfield deviceBitfield{1};
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<OsContext> osContexts[enginesCount];
+    std::unique_ptr<MockCommandStreamReceiver> csrs[enginesCount];
+    NEO::EnginesT engines;
+};
+
+TEST_F(LeastBusyCsrSelectionTest, givenEnginesWithDifferentOutstandingTasksWhenSelectingLeastBusyCsrThenEngineWithFewestOutstandingTasksIsReturned) {
+    setLoad(0, 10, 2);
+    setLoad(1, 10, 9);
+    setLoad(2, 20, 15);
+    setLoad(3, 5, 0);
+
+    EXPECT_EQ(csrs[1].get(), DeviceImp::selectLeastBusyCsr(engines, 0));
+    EXPECT_EQ(csrs[1].get(), DeviceImp::selectLeastBusyCsr(engines, 3));
+
+    setLoad(1, 10, 10);
+    setLoad(3, 5, 5);
+    EXPECT_EQ(csrs[1].get(), DeviceImp::selectLeastBusyCsr(engines, 1));
+    EXPECT_EQ(csrs[3].get(), DeviceImp::selectLeastBusyCsr(engines, 2));
+    EXPECT_EQ(csrs[3].get(), DeviceImp::selectLeastBusyCsr(engines, 3));
+}
+
+TEST_F(LeastBusyCsrSelectionTest, givenTagAheadOfTaskCountWhenSelectingLeastBusyCsrThenEngineIsTreatedAsIdle) {
+    setLoad(0, 4, 3);
+    setLoad(1, 4, 6);
+    setLoad(2, 4, 3);
+    setLoad(3, 4, 3);
+
+    EXPECT_EQ(csrs[1].get(), DeviceImp::selectLeastBusyCsr(engines, 0));
+}
+
+TEST_F(LeastBusyCsrSelectionTest, givenEnginesCompletingWorkAtDifferentRatesWhenSimulatingSubmissionsThenWorkFollowsEngineThroughput) {
+    uint32_t submissionsPerEngine[enginesCount] = {};
+    uint32_t startIndex = 0;
+
+    // two submissions per step against a total throughput of ~2.08 tasks per step
+    for (uint32_t step = 1; step <= 300; step++) {
+        for (uint32_t submission = 0; submission < 2; submission++) {
+            auto csr = static_cast<MockCommandStreamReceiver *>(DeviceImp::selectLeastBusyCsr(engines, startIndex++));
+            csr->taskCount.store(csr->taskCount.load() + 1);
+            for (uint32_t i = 0; i < enginesCount; i++) {
+                submissionsPerEngine[i] += (csrs[i].get() == csr) ? 1u : 0u;
+            }
+        }
+        for (uint32_t i = 0; i < enginesCount; i++) {
+            // engine i retires one task every (i + 1) steps
+            if ((step % (i + 1)) == 0 && *csrs[i]->tagAddress < csrs[i]->taskCount.load()) {
+                *csrs[i]->tagAddress = *csrs[i]->tagAddress + 1;
+            }
+        }
+
+        TaskCountType minOutstanding = std::numeric_limits<TaskCountType>::max();
+        TaskCountType maxOutstanding = 0;
+        for (uint32_t i = 0; i < enginesCount; i++) {
+            TaskCountType outstanding = csrs[i]->taskCount.load() - *csrs[i]->tagAddress;
+            minOutstanding = std::min(minOutstanding, outstanding);
+            maxOutstanding = std::max(maxOutstanding, outstanding);
+        }
+        EXPECT_LE(maxOutstanding - minOutstanding, 1u);
+    }
+
+    for (uint32_t i = 1; i < enginesCount; i++) {
+        EXPECT_GT(submissionsPerEngine[i - 1], submissionsPerEngine[i]);
+    }
+}
+
+TEST(L0DeviceTest, givenOrdinalOutsideOfRegularEngineGroupsWhenGettingLeastBusyCsrThenDefaultCsrIsReturned) {
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    std::unique_ptr<DriverHandleImp> driverHandle(new DriverHandleImp);
+    auto hwInfo = *NEO::defaultHwInfo;
+    auto neoDevice = std::unique_ptr<NEO::Device>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+
+    auto device = std::unique_ptr<L0::Device>(Device::create(driverHandle.get(), neoDevice.release(), false, &returnValue));
+    ASSERT_NE(nullptr, device);
+    auto deviceImp = static_cast<DeviceImp *>(device.get());
+
+    auto defaultCsr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    auto numEngineGroups = static_cast<uint32_t>(deviceImp->getActiveDevice()->getRegularEngineGroups().size());
+    EXPECT_EQ(defaultCsr, deviceImp->getLeastBusyCsrForOrdinal(numEngineGroups, defaultCsr));
+}
+
 TEST(L0DeviceTest, GivenCreatedDeviceHandleWhenCallingdeviceReinitThenNewDeviceHandleIsNotCreated) {
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     std::unique_ptr<DriverHandleImp> driverHandle(new DriverHandleImp);
@@ -5252,5 +5381,10 @@ TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListAppendWaitOnM
     EXPECT_NE(map.end(), map.find("zexCommandListAppendWaitOnMemory64"));
 }
 
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForZexCommandListAppendLaunchKernelBatchThenReturnCorrectValue) {
+    auto map = getExtensionFunctionsLookupMap();
+    EXPECT_NE(map.end(), map.find("zexCommandListAppendLaunchKernelBatch"));
+}
+
 } // namespace ult
 } // namespace L0
@@ -23,6 +23,7 @@
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/context/context_imp.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
@@ -326,6 +327,285 @@ TEST_F(EventPoolCreate, GivenDeviceThenEventPoolIsCreated) {
     }
     eventPool->destroy();
 }
+TEST_F(EventPoolCreate, givenEventArenaEnabledWhenCreatingSmallEventPoolsThenStorageIsSubAllocatedFromSharedSlab) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventArena.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool0 = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_NE(nullptr, eventPool0);
+    auto eventPool1 = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_NE(nullptr, eventPool1);
+
+    EXPECT_TRUE(eventPool0->isAllocatedFromEventArena());
+    EXPECT_TRUE(eventPool1->isAllocatedFromEventArena());
+    EXPECT_EQ(&eventPool0->getAllocation(), &eventPool1->getAllocation());
+    EXPECT_NE(eventPool0->getAllocationOffset(), eventPool1->getAllocationOffset());
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 1;
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool1->createEvent(&eventDesc, &hEvent));
+    auto event = Event::fromHandle(hEvent);
+    auto allocation = eventPool1->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    EXPECT_EQ(allocation->getGpuAddress() + eventPool1->getAllocationOffset() + eventPool1->getEventSize(), event->getGpuAddress(device));
+    EXPECT_EQ(ptrOffset(allocation->getUnderlyingBuffer(), eventPool1->getAllocationOffset() + eventPool1->getEventSize()), event->getHostAddress());
+    event->destroy();
+
+    auto releasedOffset = eventPool0->getAllocationOffset();
+    eventPool0->destroy();
+    auto eventPool2 = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_NE(nullptr, eventPool2);
+    EXPECT_EQ(releasedOffset, eventPool2->getAllocationOffset());
+
+    eventPool1->destroy();
+    eventPool2->destroy();
+}
+
+TEST_F(EventPoolCreate, givenEventArenaEnabledWhenCreatingIpcOrLargeEventPoolThenDedicatedAllocationIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventArena.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> ipcEventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, ipcEventPool);
+    EXPECT_FALSE(ipcEventPool->isAllocatedFromEventArena());
+
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = EventArena::slabEventsCount + 1;
+    std::unique_ptr<L0::EventPool> largeEventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, largeEventPool);
+    EXPECT_FALSE(largeEventPool->isAllocatedFromEventArena());
+    EXPECT_EQ(0u, largeEventPool->getAllocationOffset());
+}
+
+TEST_F(EventPoolCreate, givenEventArenaWhenObtainingBlocksThenLargerBlocksAreSplitAndReleasedBlocksAreReused) {
+    constexpr uint32_t eventSize = 64;
+    EventArena eventArena(device, NEO::AllocationType::bufferHostMemory, eventSize, MemoryConstants::cacheLineSize);
+    EXPECT_EQ(0u, eventArena.getSlabsCount());
+    EXPECT_EQ(0u, EventArena::getSizeClass(1));
+    EXPECT_EQ(2u, EventArena::getSizeClass(3));
+    EXPECT_EQ(EventArena::slabEventsCountLog2, EventArena::getSizeClass(EventArena::slabEventsCount));
+
+    EventArena::Block single{};
+    ASSERT_TRUE(eventArena.obtain(1, single));
+    EXPECT_EQ(1u, eventArena.getSlabsCount());
+    EXPECT_EQ(0u, single.offset);
+
+    EventArena::Block pair{};
+    ASSERT_TRUE(eventArena.obtain(2, pair));
+    EXPECT_EQ(2u * eventSize, pair.offset);
+    EXPECT_EQ(single.allocation, pair.allocation);
+
+    EventArena::Block second{};
+    ASSERT_TRUE(eventArena.obtain(1, second));
+    EXPECT_EQ(eventSize, second.offset);
+
+    eventArena.release(single);
+    EventArena::Block reused{};
+    ASSERT_TRUE(eventArena.obtain(1, reused));
+    EXPECT_EQ(single.offset, reused.offset);
+
+    EventArena::Block whole{};
+    ASSERT_TRUE(eventArena.obtain(EventArena::slabEventsCount, whole));
+    EXPECT_EQ(2u, eventArena.getSlabsCount());
+    EXPECT_NE(single.allocation, whole.allocation);
+
+    EventArena::Block tooLarge{};
+    EXPECT_FALSE(eventArena.obtain(EventArena::slabEventsCount + 1, tooLarge));
+}
+
+TEST_F(EventPoolCreate, givenEventArenaWhenObtainingAndReleasingEveryBlockSizeThenFreeBuddiesAreMergedAndNoSlabIsAdded) {
+    EventArena eventArena(device, NEO::AllocationType::bufferHostMemory, 64, MemoryConstants::cacheLineSize);
+
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        for (uint32_t sizeClass = 0; sizeClass < EventArena::sizeClassesCount; sizeClass++) {
+            std::vector<EventArena::Block> blocks(EventArena::slabEventsCount >> sizeClass);
+            for (auto &block : blocks) {
+                ASSERT_TRUE(eventArena.obtain(1u << sizeClass, block));
+            }
+            for (auto &block : blocks) {
+                eventArena.release(block);
+            }
+        }
+    }
+
+    EXPECT_EQ(1u, eventArena.getSlabsCount());
+}
+
+TEST_F(EventPoolCreate, givenEventArenaWhenGettingArenaForDifferentEventSizeOrAlignmentThenSeparateArenasAreReturned) {
+    auto deviceImp = static_cast<DeviceImp *>(device);
+    auto arena = deviceImp->getEventArena(NEO::AllocationType::bufferHostMemory, 64, MemoryConstants::cacheLineSize);
+
+    EXPECT_EQ(arena, deviceImp->getEventArena(NEO::AllocationType::bufferHostMemory, 64, MemoryConstants::cacheLineSize));
+    EXPECT_NE(arena, deviceImp->getEventArena(NEO::AllocationType::bufferHostMemory, 128, MemoryConstants::cacheLineSize));
+    EXPECT_NE(arena, deviceImp->getEventArena(NEO::AllocationType::bufferHostMemory, 64, MemoryConstants::pageSize64k));
+    EXPECT_NE(arena, deviceImp->getEventArena(NEO::AllocationType::gpuTimestampDeviceBuffer, 64, MemoryConstants::cacheLineSize));
+    EXPECT_EQ(4u, deviceImp->eventArenas.size());
+}
+
+TEST_F(EventPoolCreate, givenEventPoolFromEventArenaWhenDeviceDropsItsArenasBeforePoolIsDestroyedThenPoolKeepsArenaAlive) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventArena.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+    ASSERT_NE(nullptr, eventPool);
+    ASSERT_TRUE(eventPool->isAllocatedFromEventArena());
+
+    static_cast<DeviceImp *>(device)->eventArenas.clear();
+
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &hEvent));
+    auto event = Event::fromHandle(hEvent);
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    event->destroy();
+    eventPool->destroy();
+}
+
+TEST_F(EventPoolCreate, givenEventArenaEnabledOrDisabledWhenCreatingSignalingAndDestroyingEventsThenAllArenaPoolsShareOneArena) {
+    DebugManagerStateRestore restorer;
+    constexpr uint32_t iterations = 16;
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+
+    for (int32_t arenaEnabled : {0, 1}) {
+        debugManager.flags.EnableEventArena.set(arenaEnabled);
+
+        for (uint32_t i = 0; i < iterations; i++) {
+            ze_result_t result = ZE_RESULT_SUCCESS;
+            auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+            ASSERT_NE(nullptr, eventPool);
+            EXPECT_EQ(arenaEnabled == 1, eventPool->isAllocatedFromEventArena());
+
+            ze_event_handle_t hEvent = nullptr;
+            eventPool->createEvent(&eventDesc, &hEvent);
+            auto event = Event::fromHandle(hEvent);
+            event->hostSignal();
+            EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+            event->destroy();
+            eventPool->destroy();
+        }
+    }
+
+    EXPECT_EQ(1u, static_cast<DeviceImp *>(device)->eventArenas.size());
+}
+
+TEST_F(EventPoolCreate, givenEventArenaEnabledWhenCreatingCounterBasedEventPoolThenCounterBasedEventsAreHandedOutFromSlab) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventArena.set(1);
+
+    ze_event_pool_counter_based_exp_desc_t counterBasedExtension = {ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC};
+    counterBasedExtension.flags = ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE;
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        &counterBasedExtension,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_TRUE(eventPool->isAllocatedFromEventArena());
+    EXPECT_EQ(static_cast<uint32_t>(ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE), eventPool->getCounterBasedFlags());
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 3;
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &hEvent));
+    auto event = Event::fromHandle(hEvent);
+    EXPECT_TRUE(event->isCounterBased());
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getRootDeviceIndex());
+    EXPECT_EQ(ptrOffset(allocation->getUnderlyingBuffer(), eventPool->getAllocationOffset() + 3 * eventPool->getEventSize()), event->getHostAddress());
+    event->destroy();
+}
+
+TEST_F(EventPoolCreate, givenEventArenaBlockWithGpuWorkInFlightWhenReleasedThenBlockIsRecycledOnlyAfterCompletion) {
+    EventArena eventArena(device, NEO::AllocationType::bufferHostMemory, 64, MemoryConstants::cacheLineSize);
+
+    EventArena::Block block{};
+    ASSERT_TRUE(eventArena.obtain(1, block));
+
+    auto csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+    auto graphicsAllocation = block.allocation->getDefaultGraphicsAllocation();
+    graphicsAllocation->updateTaskCount(10u, csr->getOsContext().getContextId());
+    *csr->getTagAddress() = 5u;
+
+    eventArena.release(block);
+    EXPECT_EQ(1u, eventArena.getPendingBlocksCount());
+
+    // the parked block cannot complete the slab yet, so a whole-slab request needs another slab
+    EventArena::Block whole{};
+    ASSERT_TRUE(eventArena.obtain(EventArena::slabEventsCount, whole));
+    EXPECT_EQ(2u, eventArena.getSlabsCount());
+    EXPECT_EQ(1u, eventArena.getPendingBlocksCount());
+
+    *csr->getTagAddress() = 10u;
+    EventArena::Block recycledWhole{};
+    ASSERT_TRUE(eventArena.obtain(EventArena::slabEventsCount, recycledWhole));
+    EXPECT_EQ(0u, eventArena.getPendingBlocksCount());
+    EXPECT_EQ(2u, eventArena.getSlabsCount());
+    EXPECT_EQ(block.allocation, recycledWhole.allocation);
+
+    graphicsAllocation->releaseUsageInOsContext(csr->getOsContext().getContextId());
+}
+
+using EventArenaBenchmark = EventPoolCreate;
+
+TEST_F(EventArenaBenchmark, givenEventArenaEnabledOrDisabledWhenCreatingSignalingAndDestroyingEventsThenThroughputIsRecorded) {
+    DebugManagerStateRestore restorer;
+    constexpr uint32_t iterations = 256;
+
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+
+    for (int32_t arenaEnabled : {0, 1}) {
+        debugManager.flags.EnableEventArena.set(arenaEnabled);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            ze_result_t result = ZE_RESULT_SUCCESS;
+            auto eventPool = EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result);
+            ze_event_handle_t hEvent = nullptr;
+            eventPool->createEvent(&eventDesc, &hEvent);
+            Event::fromHandle(hEvent)->hostSignal();
+            Event::fromHandle(hEvent)->destroy();
+            eventPool->destroy();
+        }
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        RecordProperty(arenaEnabled == 1 ? "arenaNsPerEvent" : "dedicatedNsPerEvent", static_cast<int>(elapsedNs / iterations));
+    }
+}
+
 struct EventPoolIpcMockGraphicsAllocation : public NEO::MockGraphicsAllocation {
     using NEO::MockGraphicsAllocation::MockGraphicsAllocation;
 
@@ -1553,6 +1833,57 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenS
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventSynchronizeTest, givenHybridEventWaitEnabledWhenStateSignaledThenHostSynchronizeReturnsSuccessWithoutUpdatingCompletionTimeEstimate) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableHybridEventWait.set(1);
+
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    event->csrs[0] = csr.get();
+
+    uint32_t *hostAddr = static_cast<uint32_t *>(event->getHostAddress());
+    *hostAddr = Event::STATE_SIGNALED;
+
+    event->setUsingContextEndOffset(false);
+    ze_result_t result = event->hostSynchronize(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(NEO::WaitUtils::CompletionTimeEstimator::initialEstimateNs, csr->getCompletionTimeEstimator().getEstimateNs());
+
+    result = event->hostSynchronize(0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(NEO::WaitUtils::CompletionTimeEstimator::initialEstimateNs, csr->getCompletionTimeEstimator().getEstimateNs());
+}
+
+TEST_F(EventSynchronizeTest, givenHybridEventWaitEnabledWhenEventGetsSignaledDuringHostSynchronizeThenCompletionTimeEstimateIsUpdated) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableHybridEventWait.set(1);
+
+    struct MockEventQuery : public L0::EventImp<uint32_t> {
+        MockEventQuery(L0::Device *device) : EventImp(0, device, false) {}
+
+        ze_result_t queryStatus() override {
+            return ++queryStatusCalled > 2 ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+        }
+        uint32_t queryStatusCalled = 0;
+    };
+
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    auto mockEvent = std::make_unique<MockEventQuery>(device);
+    mockEvent->setCsr(csr.get(), true);
+
+    ze_result_t result = mockEvent->hostSynchronize(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(3u, mockEvent->queryStatusCalled);
+    EXPECT_NE(NEO::WaitUtils::CompletionTimeEstimator::initialEstimateNs, csr->getCompletionTimeEstimator().getEstimateNs());
+}
+
+TEST_F(EventSynchronizeTest, givenHybridEventWaitEnabledAndStateInitialWhenHostSynchronizeWithTimeoutIsCalledThenNotReadyIsReturned) {
+    DebugManagerStateRestore restore;
+    NEO::debugManager.flags.EnableHybridEventWait.set(1);
+
+    ze_result_t result = event->hostSynchronize(10000);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+}
+
 TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutNonZeroWhenStateSignaledThenHostSynchronizeReturnsSuccess) {
     uint32_t *hostAddr = static_cast<uint32_t *>(event->getHostAddress());
     *hostAddr = Event::STATE_SIGNALED;
@@ -2321,6 +2652,182 @@ HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenEventTimestampsWhenQueryK
     EXPECT_EQ(data.globalEnd, result.global.kernelEnd);
 }
 
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenEventTimestampsWhenQueryingKernelTimestampsInBatchThenResultsMatchSingleQueries) {
+    typename MockTimestampPackets32::Packet data[2] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 4u;
+    data[1].contextStart = 10u;
+    data[1].contextEnd = 20u;
+    data[1].globalStart = 30u;
+    data[1].globalEnd = 40u;
+
+    ze_event_desc_t secondEventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    secondEventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &secondEventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    event->hostAddress = &data[0];
+    secondEvent->hostAddress = &data[1];
+    ze_event_handle_t events[] = {event->toHandle(), secondEvent->toHandle()};
+
+    ze_kernel_timestamp_result_t expected[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryKernelTimestamp(&expected[0]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondEvent->queryKernelTimestamp(&expected[1]));
+
+    ze_kernel_timestamp_result_t results[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(2, events, results, 0));
+    EXPECT_EQ(0, memcmp(expected, results, sizeof(results)));
+
+    const auto resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(2, events, results, ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS));
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(static_cast<uint64_t>(expected[i].global.kernelStart * resolution), results[i].global.kernelStart);
+        EXPECT_EQ(static_cast<uint64_t>(expected[i].global.kernelEnd * resolution), results[i].global.kernelEnd);
+        EXPECT_EQ(static_cast<uint64_t>(expected[i].context.kernelStart * resolution), results[i].context.kernelStart);
+        EXPECT_EQ(static_cast<uint64_t>(expected[i].context.kernelEnd * resolution), results[i].context.kernelEnd);
+    }
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventQueryKernelTimestampsBatch(2, nullptr, results, 0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(0, nullptr, nullptr, 0));
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenNotSignaledEventWhenQueryingKernelTimestampsInBatchThenItsResultIsClearedAndNotReadyIsReturned) {
+    typename MockTimestampPackets32::Packet data[2] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 4u;
+    data[1].contextStart = Event::STATE_CLEARED;
+    data[1].contextEnd = Event::STATE_CLEARED;
+    data[1].globalStart = Event::STATE_CLEARED;
+    data[1].globalEnd = Event::STATE_CLEARED;
+
+    ze_event_desc_t secondEventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    secondEventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &secondEventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+    secondEvent->setUsingContextEndOffset(true);
+
+    event->hostAddress = &data[0];
+    secondEvent->hostAddress = &data[1];
+    ze_event_handle_t events[] = {event->toHandle(), secondEvent->toHandle()};
+
+    ze_kernel_timestamp_result_t results[2];
+    memset(results, 0xff, sizeof(results));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventQueryKernelTimestampsBatch(2, events, results, 0));
+    EXPECT_EQ(data[0].globalStart, results[0].global.kernelStart);
+    EXPECT_EQ(0u, results[1].global.kernelStart);
+    EXPECT_EQ(0u, results[1].global.kernelEnd);
+    EXPECT_EQ(0u, results[1].context.kernelStart);
+    EXPECT_EQ(0u, results[1].context.kernelEnd);
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenManyEventsWhenQueryingKernelTimestampsInBatchThenResultsMatchConvertedSingleQueries) {
+    constexpr uint32_t numQueries = 64;
+    typename MockTimestampPackets32::Packet data = {};
+    data.contextStart = 100u;
+    data.contextEnd = 200u;
+    data.globalStart = 300u;
+    data.globalEnd = 400u;
+    event->hostAddress = &data;
+
+    std::vector<ze_event_handle_t> events(numQueries, event->toHandle());
+    std::vector<ze_kernel_timestamp_result_t> singleResults(numQueries);
+    std::vector<ze_kernel_timestamp_result_t> batchResults(numQueries);
+    const auto resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+
+    for (uint32_t i = 0; i < numQueries; i++) {
+        auto &result = singleResults[i];
+        Event::fromHandle(events[i])->queryKernelTimestamp(&result);
+        result.global.kernelStart = static_cast<uint64_t>(result.global.kernelStart * resolution);
+        result.global.kernelEnd = static_cast<uint64_t>(result.global.kernelEnd * resolution);
+        result.context.kernelStart = static_cast<uint64_t>(result.context.kernelStart * resolution);
+        result.context.kernelEnd = static_cast<uint64_t>(result.context.kernelEnd * resolution);
+    }
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(numQueries, events.data(), batchResults.data(), ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS));
+    EXPECT_EQ(0, memcmp(singleResults.data(), batchResults.data(), numQueries * sizeof(ze_kernel_timestamp_result_t)));
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenWrappedKernelTimestampWhenQueryingKernelTimestampsInBatchWithConversionThenEndIsAfterStart) {
+    const auto validBits = device->getNEODevice()->getHardwareInfo().capabilityTable.kernelTimestampValidBits;
+    if (validBits > 32u) {
+        GTEST_SKIP();
+    }
+    const uint64_t period = 1ull << validBits;
+    typename MockTimestampPackets32::Packet data = {};
+    data.contextStart = static_cast<uint32_t>(period - 16u);
+    data.contextEnd = 16u;
+    data.globalStart = static_cast<uint32_t>(period - 16u);
+    data.globalEnd = 16u;
+    event->hostAddress = &data;
+
+    ze_event_handle_t events[] = {event->toHandle()};
+    ze_kernel_timestamp_result_t result = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(1, events, &result, ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS));
+
+    const auto resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    EXPECT_EQ(static_cast<uint64_t>((period - 16u) * resolution), result.global.kernelStart);
+    EXPECT_EQ(static_cast<uint64_t>((period + 16u) * resolution), result.global.kernelEnd);
+    EXPECT_LT(result.global.kernelStart, result.global.kernelEnd);
+    EXPECT_LT(result.context.kernelStart, result.context.kernelEnd);
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenNullEventHandleInBatchWhenQueryingKernelTimestampsThenErrorIsReturnedAndNoResultIsWritten) {
+    typename MockTimestampPackets32::Packet data = {};
+    data.globalStart = 3u;
+    data.globalEnd = 4u;
+    event->hostAddress = &data;
+
+    ze_event_handle_t events[] = {event->toHandle(), nullptr, event->toHandle()};
+    ze_kernel_timestamp_result_t results[3];
+    memset(results, 0xff, sizeof(results));
+    ze_kernel_timestamp_result_t untouched;
+    memset(&untouched, 0xff, sizeof(untouched));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventQueryKernelTimestampsBatch(3, events, results, ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS));
+    for (auto &result : results) {
+        EXPECT_EQ(0, memcmp(&untouched, &result, sizeof(result)));
+    }
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenEventsOfDevicesWithDifferentTimerResolutionsWhenQueryingKernelTimestampsInBatchThenEachEventIsConvertedWithItsDeviceResolution) {
+    typename MockTimestampPackets32::Packet data = {};
+    data.contextStart = 100u;
+    data.contextEnd = 200u;
+    data.globalStart = 300u;
+    data.globalEnd = 400u;
+
+    ze_result_t returnValue;
+    auto otherNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(NEO::defaultHwInfo.get());
+    const auto resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    const auto otherResolution = 4 * resolution;
+    otherNeoDevice->deviceInfo.profilingTimerResolution = otherResolution;
+    auto otherDevice = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), otherNeoDevice, false, &returnValue));
+    ASSERT_NE(nullptr, otherDevice);
+
+    ze_event_desc_t secondEventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    secondEventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &secondEventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    event->hostAddress = &data;
+    secondEvent->hostAddress = &data;
+    secondEvent->device = otherDevice.get();
+    ze_event_handle_t events[] = {event->toHandle(), event->toHandle(), secondEvent->toHandle()};
+
+    ze_kernel_timestamp_result_t results[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestampsBatch(3, events, results, ZEX_KERNEL_TIMESTAMP_BATCH_FLAG_CONVERT_TO_NS));
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(static_cast<uint64_t>(data.globalStart * resolution), results[i].global.kernelStart);
+        EXPECT_EQ(static_cast<uint64_t>(data.globalEnd * resolution), results[i].global.kernelEnd);
+    }
+    EXPECT_EQ(static_cast<uint64_t>(data.globalStart * otherResolution), results[2].global.kernelStart);
+    EXPECT_EQ(static_cast<uint64_t>(data.globalEnd * otherResolution), results[2].global.kernelEnd);
+}
+
 TEST_F(TimestampEventUsedPacketSignalCreate, givenEventWhenQueryingTimestampExpThenCorrectDataSet) {
     typename MockTimestampPackets32::Packet packetData[2];
     event->setPacketsInUse(2u);
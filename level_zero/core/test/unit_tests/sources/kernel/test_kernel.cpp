@@ -19,6 +19,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/kernel_info_from_patchtokens.h"
+#include "shared/source/program/print_formatter.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
@@ -2181,6 +2182,61 @@ HWTEST2_F(KernelImpPatchBindlessTest, GivenKernelImpWhenSetSurfaceStateBindlessT
     EXPECT_FALSE(mockKernel.usingSurfaceStateHeap[0]);
 }
 
+HWTEST2_F(KernelImpPatchBindlessTest, GivenBindlessSurfaceStateReuseEnabledWhenSettingSameBufferTwiceThenSurfaceStateIsNotReprogrammed, MatchAny) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableBindlessSurfaceStateReuse.set(1);
+
+    ze_kernel_desc_t desc = {};
+    desc.pKernelName = kernelName.c_str();
+
+    WhiteBoxKernelHw<gfxCoreFamily> mockKernel;
+    mockKernel.module = module.get();
+    mockKernel.initialize(&desc);
+    auto &arg = const_cast<NEO::ArgDescPointer &>(mockKernel.kernelImmData->getDescriptor().payloadMappings.explicitArgs[0].template as<NEO::ArgDescPointer>());
+    arg.bindless = 0x40;
+    arg.bindful = undefined<SurfaceStateHeapOffset>;
+    const_cast<NEO::KernelDescriptor &>(mockKernel.kernelImmData->getDescriptor()).kernelAttributes.bufferAddressingMode = NEO::KernelDescriptor::BindlessAndStateless;
+    const_cast<NEO::KernelDescriptor &>(mockKernel.kernelImmData->getDescriptor()).kernelAttributes.imageAddressingMode = NEO::KernelDescriptor::Bindless;
+
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()]->createBindlessHeapsHelper(neoDevice->getMemoryManager(),
+                                                                                                                             neoDevice->getNumGenericSubDevices() > 1,
+                                                                                                                             neoDevice->getRootDeviceIndex(),
+                                                                                                                             neoDevice->getDeviceBitfield());
+    auto bindlessHeapsHelper = neoDevice->getBindlessHeapsHelper();
+
+    auto &gfxCoreHelper = device->getGfxCoreHelper();
+    size_t size = gfxCoreHelper.getRenderSurfaceStateSize();
+    uint64_t gpuAddress = 0x2000;
+    void *buffer = reinterpret_cast<void *>(gpuAddress);
+
+    NEO::MockGraphicsAllocation mockAllocation(buffer, gpuAddress, size);
+    auto expectedSsInHeap = bindlessHeapsHelper->allocateSSInHeap(size, &mockAllocation, NEO::BindlessHeapsHelper::globalSsh);
+    mockAllocation.setBindlessInfo(expectedSsInHeap);
+    EXPECT_FALSE(mockAllocation.getBindlessSurfaceStateKey().valid);
+
+    mockKernel.setBufferSurfaceState(0, buffer, &mockAllocation);
+    EXPECT_TRUE(mockAllocation.getBindlessSurfaceStateKey().valid);
+    EXPECT_EQ(0u, bindlessHeapsHelper->getReusedSurfaceStatesCount());
+
+    memset(expectedSsInHeap.ssPtr, 0, size);
+    auto surfaceStateBefore = *reinterpret_cast<RENDER_SURFACE_STATE *>(expectedSsInHeap.ssPtr);
+
+    mockKernel.setBufferSurfaceState(0, buffer, &mockAllocation);
+    auto surfaceStateAfter = *reinterpret_cast<RENDER_SURFACE_STATE *>(expectedSsInHeap.ssPtr);
+
+    EXPECT_TRUE(memcmp(&surfaceStateAfter, &surfaceStateBefore, size) == 0);
+    EXPECT_EQ(1u, bindlessHeapsHelper->getReusedSurfaceStatesCount());
+    EXPECT_TRUE(mockKernel.isBindlessOffsetSet[0]);
+
+    mockAllocation.setBindlessInfo(expectedSsInHeap);
+    mockKernel.setBufferSurfaceState(0, buffer, &mockAllocation);
+    surfaceStateAfter = *reinterpret_cast<RENDER_SURFACE_STATE *>(expectedSsInHeap.ssPtr);
+
+    EXPECT_FALSE(memcmp(&surfaceStateAfter, &surfaceStateBefore, size) == 0);
+    EXPECT_EQ(1u, bindlessHeapsHelper->getReusedSurfaceStatesCount());
+}
+
 HWTEST2_F(KernelImpPatchBindlessTest, GivenMisalignedBufferAddressWhenSettingSurfaceStateThenSurfaceStateInKernelHeapIsUsed, MatchAny) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
 
@@ -3497,6 +3553,53 @@ HWTEST_F(PrintfHandlerTests, givenPrintDebugMessagesAndKernelWithPrintfWhenBlitt
     }
 }
 
+TEST_F(PrintfHandlerTests, givenAsyncPrintfOutputEnabledWhenPrintingOutputThenBufferIsResetAndOutputIsPrintedByWorker) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableAsyncPrintfOutput.set(1);
+
+    auto device = std::unique_ptr<NEO::MockDevice>(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(defaultHwInfo.get(), 0));
+    {
+        device->incRefInternal();
+        MockDeviceImp deviceImp(device.get(), device->getExecutionEnvironment());
+
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        kernelInfo->heapInfo.kernelHeapSize = 1;
+        char kernelHeap[1];
+        kernelInfo->heapInfo.pKernelHeap = &kernelHeap;
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = ZebinTestData::ValidEmptyProgram<>::kernelName;
+
+        auto kernelImmutableData = std::make_unique<KernelImmutableData>(&deviceImp);
+        kernelImmutableData->initialize(kernelInfo.get(), &deviceImp, 0, nullptr, nullptr, false);
+
+        auto &kernelDescriptor = kernelInfo->kernelDescriptor;
+        kernelDescriptor.kernelAttributes.flags.usesPrintf = true;
+        kernelDescriptor.kernelAttributes.flags.usesStringMapForPrintf = true;
+        kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::patchtokens;
+        kernelDescriptor.kernelAttributes.gpuPointerSize = 8u;
+        std::string expectedString("test123");
+        kernelDescriptor.kernelMetadata.printfStringsMap.insert(std::make_pair(0u, expectedString));
+
+        constexpr size_t size = 128;
+        uint64_t gpuAddress = 0x2000;
+        uint32_t bufferArray[size] = {};
+        void *buffer = reinterpret_cast<void *>(bufferArray);
+        NEO::MockGraphicsAllocation mockAllocation(buffer, gpuAddress, size);
+        auto printfAllocation = reinterpret_cast<uint32_t *>(buffer);
+        printfAllocation[0] = 8;
+        printfAllocation[1] = 0;
+
+        testing::internal::CaptureStdout();
+        PrintfHandler::printOutput(kernelImmutableData.get(), &mockAllocation, &deviceImp, false);
+        EXPECT_EQ(sizeof(uint32_t), printfAllocation[0]);
+        ASSERT_NE(nullptr, deviceImp.printfOutputWorker);
+
+        deviceImp.drainPrintfOutput();
+        std::string output = testing::internal::GetCapturedStdout();
+        EXPECT_STREQ(expectedString.c_str(), output.c_str());
+        EXPECT_EQ(1u, kernelImmutableData->getPrintfFormatCache()->getCompiledFormatsCount());
+    }
+}
+
 using KernelPatchtokensPrintfStringMapTests = Test<ModuleImmutableDataFixture>;
 
 TEST_F(KernelPatchtokensPrintfStringMapTests, givenKernelWithPrintfStringsMapUsageEnabledWhenPrintOutputThenProperStringIsPrinted) {
@@ -8,6 +8,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/occupancy_work_group_size.h"
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/test/common/helpers/raii_gfx_core_helper.h"
 #include "shared/test/common/mocks/mock_bindless_heaps_helper.h"
@@ -322,6 +323,88 @@ TEST_P(KernelImpSuggestGroupSize, WhenSlmSizeExceedsLocalMemorySizeAndSuggesting
     EXPECT_EQ(0, strcmp(expectedOutput.c_str(), errorMsg));
 }
 
+TEST_F(KernelImpTest, givenOccupancySuggestionEnabledWhenSuggestingGroupSizeThenGroupDividesGlobalSizeWithoutIdleLanesAndIsCached) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableOccupancyWorkGroupSizeSuggestion.set(1);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.simdSize = 32;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 64;
+
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3];
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_LE(groupSize[0], 64u);
+    EXPECT_EQ(0u, 256u % groupSize[0]);
+    EXPECT_EQ(0u, groupSize[0] % 32u);
+    EXPECT_EQ(1u, groupSize[1]);
+    EXPECT_EQ(1u, groupSize[2]);
+
+    ASSERT_EQ(1u, kernel.suggestGroupSizeCache.size());
+    EXPECT_EQ(groupSize[0], kernel.suggestGroupSizeCache[0].suggestedGroupSize[0]);
+}
+
+TEST_F(KernelImpTest, givenOccupancySuggestionEnabledAndSlmExceedingSubsliceWhenSuggestingGroupSizeThenOutOfDeviceMemoryIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableOccupancyWorkGroupSizeSuggestion.set(1);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.simdSize = 32;
+    descriptor.kernelAttributes.slmInlineSize = static_cast<uint32_t>(device->getHwInfo().capabilityTable.slmSize * MemoryConstants::kiloByte) + 1024u;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t groupSize[3];
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(0u, kernel.suggestGroupSizeCache.size());
+}
+
+TEST_F(KernelImpTest, givenOccupancySuggestionEnabledAndBarriersExceedingSubsliceWhenSuggestingGroupSizeThenBarrierErrorIsReportedAndOutOfDeviceMemoryIsReturned) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableOccupancyWorkGroupSizeSuggestion.set(1);
+    NEO::debugManager.flags.PrintDebugMessages.set(true);
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.simdSize = 32;
+    descriptor.kernelAttributes.barrierCount = static_cast<uint8_t>(device->getGfxCoreHelper().getMaxBarrierRegisterPerSlice() + 1);
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    auto occupancyInfo = NEO::OccupancyInfo::create(descriptor, device->getNEODevice()->getRootDeviceEnvironment(), 1024u, 0u);
+
+    ::testing::internal::CaptureStderr();
+    uint32_t groupSize[3];
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(0u, kernel.suggestGroupSizeCache.size());
+
+    auto output = testing::internal::GetCapturedStderr();
+    std::string expectedOutput = "Number of barriers (" + std::to_string(descriptor.kernelAttributes.barrierCount) + ") larger than available (" + std::to_string(occupancyInfo.maxBarrierCount) + ")\n";
+    EXPECT_EQ(expectedOutput, output);
+
+    const char *errorMsg = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device->getDriverHandle()->getErrorDescription(&errorMsg));
+    EXPECT_EQ(0, strcmp(expectedOutput.c_str(), errorMsg));
+}
+
 TEST_F(KernelImpTest, GivenInvalidValuesWhenSettingGroupSizeThenInvalidArgumentErrorIsReturned) {
     Mock<KernelImp> kernel;
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, kernel.KernelImp::setGroupSize(0U, 1U, 1U));
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/default_hw_info.h"
@@ -1549,6 +1550,265 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhe
     EXPECT_EQ(static_cast<DeviceImp *>(testL0Device.get())->bcsSplit.events.createdFromLatestPool, 12u);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenAdaptiveBcsSplitWhenObtainingEventsLockFreeThenSetsInUseAreNotSharedAndSignaledSetsAreReused, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SplitBcsCopy.set(1);
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+    debugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    EXPECT_TRUE(bcsSplit.adaptiveSplit);
+    EXPECT_EQ(BcsSplit::minAdaptiveSplitSize, static_cast<CommandList *>(commandList0.get())->minimalSizeForBcsSplit);
+    auto context = Context::fromHandle(commandList0->getCmdListContext());
+
+    auto first = bcsSplit.events.obtainForSplitLockFree(context, 12);
+    EXPECT_EQ(0u, first);
+    EXPECT_EQ(1u, bcsSplit.events.timestampPools.size());
+    EXPECT_EQ(4u, bcsSplit.events.createdFromLatestTimestampPool);
+    EXPECT_EQ(2u, bcsSplit.events.createdFromLatestPool);
+
+    bcsSplit.events.marker[first]->hostSignal();
+    auto second = bcsSplit.events.obtainForSplitLockFree(context, 12);
+    EXPECT_EQ(1u, second);
+    EXPECT_EQ(2u, bcsSplit.events.publishedSets.load());
+
+    bcsSplit.events.releaseSet(first);
+    auto third = bcsSplit.events.obtainForSplitLockFree(context, 12);
+    EXPECT_EQ(first, third);
+    EXPECT_EQ(2u, bcsSplit.events.marker.size());
+    EXPECT_NE(ZE_RESULT_SUCCESS, bcsSplit.events.marker[third]->queryStatus());
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenAdaptiveBcsSplitWithAllEventSetsAllocatedWhenWaitingForPendingSetThenSetsClaimedByOtherAppendsAreSkippedAndNoSetIsAllocated, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SplitBcsCopy.set(1);
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+    debugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    auto context = Context::fromHandle(commandList0->getCmdListContext());
+
+    for (size_t i = 0; i < BcsSplit::Events::maxLockFreeEventSets; i++) {
+        EXPECT_EQ(i, bcsSplit.events.obtainForSplitLockFree(context, 12));
+    }
+    for (size_t i = 0; i < BcsSplit::Events::maxLockFreeEventSets; i++) {
+        if (i != 5u) {
+            bcsSplit.events.releaseSet(i);
+        }
+    }
+
+    bcsSplit.events.marker[5]->hostSignal();
+    bcsSplit.events.marker[6]->hostSignal();
+    bcsSplit.events.nextSetHint.store(5u);
+
+    EXPECT_EQ(6u, bcsSplit.events.waitForPendingSet());
+    EXPECT_TRUE(bcsSplit.events.setInUse[6].load());
+    EXPECT_NE(ZE_RESULT_SUCCESS, bcsSplit.events.marker[6]->queryStatus());
+    EXPECT_EQ(BcsSplit::Events::maxLockFreeEventSets, bcsSplit.events.marker.size());
+    EXPECT_EQ(BcsSplit::Events::maxLockFreeEventSets, bcsSplit.events.publishedSets.load());
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenAdaptiveBcsSplitWhenGettingChunkSizesThenSizesFollowBandwidthAndBusyEnginesAreSkipped, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SplitBcsCopy.set(1);
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+    debugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(4u, bcsSplit.cmdQs.size());
+
+    const size_t size = 16 * MemoryConstants::megaByte;
+    auto chunkSizes = bcsSplit.getAdaptiveChunkSizes(bcsSplit.cmdQs, size);
+    ASSERT_EQ(4u, chunkSizes.size());
+    for (auto chunkSize : chunkSizes) {
+        EXPECT_EQ(size / 4, chunkSize);
+    }
+
+    bcsSplit.engineBytesPerNs[0].store(3.0);
+    bcsSplit.engineBytesPerNs[1].store(1.0);
+    bcsSplit.engineBytesPerNs[2].store(1.0);
+    bcsSplit.engineBytesPerNs[3].store(1.0);
+    chunkSizes = bcsSplit.getAdaptiveChunkSizes(bcsSplit.cmdQs, size);
+    EXPECT_EQ(size / 2, chunkSizes[0]);
+    EXPECT_EQ(alignDown(size / 6, MemoryConstants::pageSize), chunkSizes[1]);
+    EXPECT_EQ(size, chunkSizes[0] + chunkSizes[1] + chunkSizes[2] + chunkSizes[3]);
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize>(chunkSizes[0]));
+
+    auto busyCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[3])->getCsr());
+    busyCsr->taskCount = 10u;
+    *busyCsr->getTagAddress() = 0u;
+    chunkSizes = bcsSplit.getAdaptiveChunkSizes(bcsSplit.cmdQs, size);
+    EXPECT_EQ(0u, chunkSizes[3]);
+    EXPECT_EQ(size, chunkSizes[0] + chunkSizes[1] + chunkSizes[2]);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenAdaptiveBcsSplitWhenSplitCompletesThenThresholdFollowsSplitSpanAgainstSingleEngineSample, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SplitBcsCopy.set(1);
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+    debugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(4u, bcsSplit.cmdQs.size());
+    auto context = Context::fromHandle(commandList0->getCmdListContext());
+
+    const size_t size = 16 * MemoryConstants::megaByte;
+    bcsSplit.adaptiveSplitsCount.store(BcsSplit::singleEngineProbePeriod - 1);
+    auto chunkSizes = bcsSplit.getAdaptiveChunkSizes(bcsSplit.cmdQs, size);
+    EXPECT_EQ(size, chunkSizes[0]);
+    EXPECT_EQ(0u, chunkSizes[1] + chunkSizes[2] + chunkSizes[3]);
+
+    auto setIndex = bcsSplit.events.obtainForSplitLockFree(context, 12);
+    auto setSubcopy = [&](size_t engine, size_t subcopySize, uint32_t start, uint32_t end) {
+        auto index = setIndex * bcsSplit.cmdQs.size() + engine;
+        bcsSplit.events.subcopySizes[index] = subcopySize;
+        bcsSplit.events.subcopyCmdQs[index] = bcsSplit.cmdQs[engine];
+
+        typename NEO::TimestampPackets<typename FamilyType::TimestampPacketType, NEO::TimestampPacketConstants::preferredPacketCount>::Packet packet = {};
+        packet.contextStart = start;
+        packet.globalStart = start;
+        packet.contextEnd = end;
+        packet.globalEnd = end;
+        memcpy(bcsSplit.events.subcopy[index]->getHostAddress(), &packet, sizeof(packet));
+    };
+
+    // multi-engine splits are not judged until a single-engine reference exists
+    for (size_t engine = 0; engine < 4; engine++) {
+        setSubcopy(engine, MemoryConstants::megaByte, 1000u, 2000u);
+    }
+    bcsSplit.recordSplitCompletion(setIndex);
+    EXPECT_EQ(BcsSplit::defaultAdaptiveSplitSize, bcsSplit.getAdaptiveMinimalSplitSize());
+
+    setSubcopy(0, 4 * MemoryConstants::megaByte, 1000u, 5000u);
+    for (size_t engine = 1; engine < 4; engine++) {
+        bcsSplit.events.subcopySizes[setIndex * bcsSplit.cmdQs.size() + engine] = 0u;
+    }
+    bcsSplit.recordSplitCompletion(setIndex);
+    EXPECT_LT(0.0, bcsSplit.singleEngineBytesPerNs.load());
+    EXPECT_EQ(BcsSplit::defaultAdaptiveSplitSize, bcsSplit.getAdaptiveMinimalSplitSize());
+
+    // engines copying concurrently: four times the single-engine throughput
+    for (size_t engine = 0; engine < 4; engine++) {
+        setSubcopy(engine, MemoryConstants::megaByte, 1000u, 2000u);
+    }
+    bcsSplit.recordSplitCompletion(setIndex);
+    auto shrunkThreshold = BcsSplit::defaultAdaptiveSplitSize - BcsSplit::defaultAdaptiveSplitSize / 5;
+    EXPECT_EQ(shrunkThreshold, bcsSplit.getAdaptiveMinimalSplitSize());
+
+    // engines serialized one after another: each subcopy alone is fast, but the split is no faster than one engine
+    for (uint32_t engine = 0; engine < 4; engine++) {
+        setSubcopy(engine, MemoryConstants::megaByte, 1000u + engine * 1000u, 2000u + engine * 1000u);
+    }
+    bcsSplit.recordSplitCompletion(setIndex);
+    EXPECT_EQ(shrunkThreshold + shrunkThreshold / 4, bcsSplit.getAdaptiveMinimalSplitSize());
+
+    bcsSplit.events.releaseSet(setIndex);
+}
+
+HWTEST2_F(CommandQueueCommandsXeHpc, givenAdaptiveBcsSplitWhenCheckingIfSplitIsNeededThenTunedThresholdIsUsed, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.SplitBcsCopy.set(1);
+    debugManager.flags.EnableAdaptiveBcsSplit.set(1);
+    debugManager.flags.EnableFlushTaskSubmission.set(0);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t desc = {};
+    desc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::copy));
+
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               testL0Device.get(),
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::copy,
+                                                                               returnValue));
+    ASSERT_NE(nullptr, commandList0);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    auto cmdList = static_cast<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>> *>(commandList0.get());
+    NEO::TransferDirection direction;
+
+    EXPECT_EQ(BcsSplit::defaultAdaptiveSplitSize, bcsSplit.getAdaptiveMinimalSplitSize());
+    EXPECT_FALSE(cmdList->isAppendSplitNeeded(NEO::MemoryPool::localMemory, NEO::MemoryPool::system4KBPages, 2 * MemoryConstants::megaByte, direction));
+    EXPECT_TRUE(cmdList->isAppendSplitNeeded(NEO::MemoryPool::localMemory, NEO::MemoryPool::system4KBPages, 4 * MemoryConstants::megaByte, direction));
+
+    bcsSplit.adaptiveMinimalSplitSize.store(BcsSplit::minAdaptiveSplitSize);
+    EXPECT_TRUE(cmdList->isAppendSplitNeeded(NEO::MemoryPool::localMemory, NEO::MemoryPool::system4KBPages, 2 * MemoryConstants::megaByte, direction));
+    EXPECT_FALSE(cmdList->isAppendSplitNeeded(NEO::MemoryPool::localMemory, NEO::MemoryPool::localMemory, 2 * MemoryConstants::megaByte, direction));
+}
+
 HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndImmediateCommandListWhenAppendingPageFaultCopyThenSuccessIsReturned, IsXeHpcCore) {
     using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
 
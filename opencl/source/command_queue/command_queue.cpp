@@ -10,6 +10,7 @@
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/command_stream/aub_subcapture_status.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/staging_transfer_engine.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm.h"
@@ -17,6 +18,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/bit_helpers.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
@@ -1036,6 +1038,29 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::stagingWriteAllowed(Buffer *buffer, cl_bool blocking, size_t size, GraphicsAllocation *mapAllocation,
+                                       cl_uint numEventsInWaitList, cl_event *event, CommandStreamReceiver &csr) {
+    if (!StagingTransferEngine::isEnabled() || blocking == CL_FALSE || mapAllocation || numEventsInWaitList > 0 || event) {
+        return false;
+    }
+    if (!EngineHelpers::isBcs(csr.getOsContext().getEngineType())) {
+        return false;
+    }
+    auto allocation = buffer->getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    if (!allocation->isAllocatedInLocalMemoryPool() || buffer->getMultiGraphicsAllocation().requiresMigrations()) {
+        return false;
+    }
+    return getDevice().getStagingTransferEngine()->isTransferSizeSupported(size);
+}
+
+BlitOperationResult CommandQueue::stagingWriteBuffer(Buffer *buffer, size_t offset, size_t size, const void *ptr, CommandStreamReceiver &csr) {
+    if (finish() != CL_SUCCESS) {
+        return BlitOperationResult::gpuHang;
+    }
+    auto allocation = buffer->getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    return getDevice().getStagingTransferEngine()->write(csr, allocation, buffer->getOffset() + offset, ptr, size);
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || debugManager.flags.OmitTimestampPacketDependencies.get();
 }
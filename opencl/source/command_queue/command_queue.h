@@ -40,6 +40,7 @@ class Kernel;
 class LinearStream;
 class PerformanceCounters;
 class PrintfHandler;
+enum class BlitOperationResult;
 enum class WaitStatus;
 struct BuiltinOpParams;
 struct CsrSelectionArgs;
@@ -402,6 +403,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool stagingWriteAllowed(Buffer *buffer, cl_bool blocking, size_t size, GraphicsAllocation *mapAllocation,
+                             cl_uint numEventsInWaitList, cl_event *event, CommandStreamReceiver &csr);
+    BlitOperationResult stagingWriteBuffer(Buffer *buffer, size_t offset, size_t size, const void *ptr, CommandStreamReceiver &csr);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
@@ -7,8 +7,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/memcpy_engine.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/logger.h"
 
@@ -152,10 +154,23 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
+            if (debugManager.flags.EnableStreamingCpuCopy.get() == 1) {
+                MemcpyEngine::copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0],
+                                   transferProperties.lockedPtr ? MemcpyHint::uncachedSource : MemcpyHint::cacheable, getDevice().getExecutionEnvironment()->getMemcpyThreadPool());
+                eventCompleted = true;
+                break;
+            }
             memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
+            if (debugManager.flags.EnableStreamingCpuCopy.get() == 1) {
+                MemcpyEngine::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0],
+                                   transferProperties.lockedPtr ? MemcpyHint::writeCombinedDestination : MemcpyHint::cacheable, getDevice().getExecutionEnvironment()->getMemcpyThreadPool());
+                eventCompleted = true;
+                modifySimulationFlags = true;
+                break;
+            }
             memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             modifySimulationFlags = true;
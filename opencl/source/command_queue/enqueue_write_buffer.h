@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/blit_helper.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
@@ -58,6 +59,15 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    if (stagingWriteAllowed(buffer, blockingWrite, size, mapAllocation, numEventsInWaitList, event, csr)) {
+        auto stagingResult = stagingWriteBuffer(buffer, offset, size, ptr, csr);
+        if (stagingResult == BlitOperationResult::success) {
+            return CL_SUCCESS;
+        } else if (stagingResult == BlitOperationResult::gpuHang) {
+            return CL_OUT_OF_RESOURCES;
+        }
+    }
+
     auto eBuiltInOps = EBuiltInOps::copyBufferToBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::copyBufferToBufferStateless;
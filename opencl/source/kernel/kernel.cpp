@@ -2293,6 +2293,9 @@ void Kernel::initializeLocalIdsCache() {
     auto simdSize = getDescriptor().kernelAttributes.simdSize;
     auto grfSize = static_cast<uint8_t>(getDevice().getHardwareInfo().capabilityTable.grfSize);
     localIdsCache = std::make_unique<LocalIdsCache>(4, wgDimOrder, simdSize, grfSize, usingImagesOnly);
+    if (debugManager.flags.EnableSharedLocalIdsCache.get() == 1) {
+        localIdsCache->setSharedCache(getDevice().getDevice().getSharedLocalIdsCache());
+    }
 }
 
 void Kernel::setLocalIdsForGroup(const Vec3<uint16_t> &groupSize, void *destination) const {
@@ -61,6 +61,10 @@ CommandContainer::CommandContainer() {
     if (debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get() != -1) {
         isHandleFenceCompletionRequired = !static_cast<bool>(debugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get());
     }
+
+    if (debugManager.flags.EnableIndirectDataReuse.get() == 1) {
+        indirectDataCache = std::make_unique<IndirectDataCache>();
+    }
 }
 
 CommandContainer::CommandContainer(uint32_t maxNumAggregatedIdds) : CommandContainer() {
@@ -206,6 +210,10 @@ void CommandContainer::reset() {
         }
     }
 
+    if (indirectDataCache) {
+        indirectDataCache->clear();
+    }
+
     iddBlock = nullptr;
     nextIddInBlock = this->getNumIddPerBlock();
     lastPipelineSelectModeRequired = false;
@@ -214,7 +222,7 @@ void CommandContainer::reset() {
     alignedPrimarySize = 0;
 }
 
-size_t CommandContainer::getAlignedCmdBufferSize() const {
+size_t CommandContainer::getAlignedCmdBufferSize() {
     auto totalCommandBufferSize = totalCmdBufferSize;
     if (debugManager.flags.OverrideCmdListCmdBufferSizeInKb.get() > 0) {
         totalCommandBufferSize = static_cast<size_t>(debugManager.flags.OverrideCmdListCmdBufferSizeInKb.get()) * MemoryConstants::kiloByte;
@@ -285,6 +293,10 @@ void CommandContainer::createAndAssignNewHeap(HeapType heapType, size_t size) {
         getDeallocationContainer().push_back(oldAlloc);
     }
     setIndirectHeapAllocation(heapType, newAlloc);
+    if (heapType == HeapType::indirectObject && indirectDataCache) {
+        // cached offsets point into the old allocation, which is released or recycled
+        indirectDataCache->clear();
+    }
     if (oldBase != newBase) {
         setHeapDirty(heapType);
     }
@@ -471,8 +483,8 @@ GraphicsAllocation *CommandContainer::reuseExistingCmdBuffer(bool forceHostMemor
     forceHostMemory &= this->useSecondaryCommandStream;
     size_t alignedSize = getAlignedCmdBufferSize();
     auto cmdBufferAllocation = this->immediateReusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
-    if (!cmdBufferAllocation) {
-        this->reusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
+    if (!cmdBufferAllocation && this->reusableAllocationList) {
+        cmdBufferAllocation = this->reusableAllocationList->detachAllocation(alignedSize, nullptr, forceHostMemory, this->immediateCmdListCsr, AllocationType::commandBuffer).release();
     }
 
     if (cmdBufferAllocation) {
@@ -500,17 +512,20 @@ GraphicsAllocation *CommandContainer::allocateCommandBuffer() {
 }
 
 GraphicsAllocation *CommandContainer::allocateCommandBuffer(bool forceHostMemory) {
-    size_t alignedSize = getAlignedCmdBufferSize();
-    AllocationProperties properties{device->getRootDeviceIndex(),
+    return createCommandBufferAllocation(*device, getAlignedCmdBufferSize(), forceHostMemory && this->useSecondaryCommandStream);
+}
+
+GraphicsAllocation *CommandContainer::createCommandBufferAllocation(Device &device, size_t alignedSize, bool forceSystemMemory) {
+    AllocationProperties properties{device.getRootDeviceIndex(),
                                     true /* allocateMemory*/,
                                     alignedSize,
                                     AllocationType::commandBuffer,
-                                    (device->getNumGenericSubDevices() > 1u) /* multiOsContextCapable */,
+                                    (device.getNumGenericSubDevices() > 1u) /* multiOsContextCapable */,
                                     false,
-                                    device->getDeviceBitfield()};
-    properties.flags.forceSystemMemory = forceHostMemory && this->useSecondaryCommandStream;
+                                    device.getDeviceBitfield()};
+    properties.flags.forceSystemMemory = forceSystemMemory;
 
-    auto commandBufferAllocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    auto commandBufferAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
     if (commandBufferAllocation) {
         commandBufferAllocation->storageInfo.systemMemoryForced = properties.flags.forceSystemMemory;
     }
@@ -518,6 +533,19 @@ GraphicsAllocation *CommandContainer::allocateCommandBuffer(bool forceHostMemory
     return commandBufferAllocation;
 }
 
+uint32_t CommandContainer::prewarmReusableCmdBuffers(Device &device, AllocationsList &reusableAllocationList, uint32_t amountToPrewarm) {
+    const size_t alignedSize = getAlignedCmdBufferSize();
+    uint32_t amountPrewarmed = 0u;
+    for (; amountPrewarmed < amountToPrewarm; amountPrewarmed++) {
+        auto cmdBufferAllocation = createCommandBufferAllocation(device, alignedSize, false);
+        if (!cmdBufferAllocation) {
+            break;
+        }
+        reusableAllocationList.pushTailOne(*cmdBufferAllocation);
+    }
+    return amountPrewarmed;
+}
+
 void CommandContainer::fillReusableAllocationLists() {
     if (this->immediateReusableAllocationList) {
         return;
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/command_container/indirect_data_cache.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_base_address_model.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
@@ -155,6 +156,8 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void addCurrentCommandBufferToReusableAllocationList();
 
     void fillReusableAllocationLists();
+    static GraphicsAllocation *createCommandBufferAllocation(Device &device, size_t alignedSize, bool forceSystemMemory);
+    static uint32_t prewarmReusableCmdBuffers(Device &device, AllocationsList &reusableAllocationList, uint32_t amountToPrewarm);
     void storeAllocationAndFlushTagUpdate(GraphicsAllocation *allocation);
 
     HeapReserveData &getSurfaceStateHeapReserve() {
@@ -205,9 +208,12 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void setHandleFenceCompletionRequired() {
         this->isHandleFenceCompletionRequired = true;
     }
+    IndirectDataCache *getIndirectDataCache() const {
+        return indirectDataCache.get();
+    }
 
   protected:
-    size_t getAlignedCmdBufferSize() const;
+    static size_t getAlignedCmdBufferSize();
     size_t getMaxUsableSpace() const {
         return getAlignedCmdBufferSize() - cmdBufferReservedSize;
     }
@@ -233,6 +239,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<LinearStream> secondaryCommandStreamForImmediateCmdList;
     std::unique_ptr<AllocationsList> immediateReusableAllocationList;
+    std::unique_ptr<IndirectDataCache> indirectDataCache;
 
     uint64_t instructionHeapBaseAddress = 0u;
     uint64_t indirectObjectHeapBaseAddress = 0u;
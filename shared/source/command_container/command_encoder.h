@@ -80,6 +80,14 @@ struct EncodeDispatchKernelArgs {
     }
 };
 
+// Features checked at runtime by EncodeDispatchKernel::encode. Encoders instantiated without a feature skip the checks
+// related to it, command lists select the instantiation matching features known at creation.
+namespace EncodeDispatchKernelFeatures {
+inline constexpr uint32_t debugFlags = 1u << 0;      // debug flags overriding commands of every launch, e.g. PauseOnEnqueue
+inline constexpr uint32_t implicitScaling = 1u << 1; // walkers partitioned across sub-devices
+inline constexpr uint32_t all = debugFlags | implicitScaling;
+} // namespace EncodeDispatchKernelFeatures
+
 enum class MiPredicateType : uint32_t {
     disable = 0,
     noopOnResult2Clear = 1,
@@ -110,9 +118,13 @@ struct EncodeDispatchKernel {
     using INTERFACE_DESCRIPTOR_DATA = typename GfxFamily::INTERFACE_DESCRIPTOR_DATA;
     using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
 
+    using EncodeFunction = void (*)(CommandContainer &container, EncodeDispatchKernelArgs &args);
+
     static void encodeCommon(CommandContainer &container, EncodeDispatchKernelArgs &args);
+    static EncodeFunction getSpecializedEncode(uint32_t features);
+    static uint32_t getRequiredEncodeFeatures(uint32_t partitionCount);
 
-    template <typename WalkerType>
+    template <typename WalkerType, uint32_t features = EncodeDispatchKernelFeatures::all>
     static void encode(CommandContainer &container, EncodeDispatchKernelArgs &args);
 
     template <typename WalkerType>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -543,6 +543,36 @@ inline void EncodeDispatchKernel<Family>::encodeCommon(CommandContainer &contain
     EncodeDispatchKernel<Family>::template encode<DefaultWalkerType>(container, args);
 }
 
+template <typename Family>
+typename EncodeDispatchKernel<Family>::EncodeFunction EncodeDispatchKernel<Family>::getSpecializedEncode(uint32_t features) {
+    using DefaultWalkerType = typename Family::DefaultWalkerType;
+    static_assert(EncodeDispatchKernelFeatures::all == 0b11);
+
+    constexpr EncodeFunction encodeFunctions[] = {
+        &EncodeDispatchKernel<Family>::template encode<DefaultWalkerType, 0u>,
+        &EncodeDispatchKernel<Family>::template encode<DefaultWalkerType, 0b01u>,
+        &EncodeDispatchKernel<Family>::template encode<DefaultWalkerType, 0b10u>,
+        &EncodeDispatchKernel<Family>::template encode<DefaultWalkerType, 0b11u>};
+
+    UNRECOVERABLE_IF((features & ~EncodeDispatchKernelFeatures::all) != 0u);
+    return encodeFunctions[features];
+}
+
+template <typename Family>
+uint32_t EncodeDispatchKernel<Family>::getRequiredEncodeFeatures(uint32_t partitionCount) {
+    uint32_t features = 0u;
+    if (debugManager.flags.PauseOnEnqueue.get() != -1 ||
+        debugManager.flags.OverrideSlmAllocationSize.get() != -1 ||
+        debugManager.flags.ForceComputeWalkerPostSyncFlush.get() != -1 ||
+        debugManager.flags.PrintKernelDispatchParameters.get()) {
+        features |= EncodeDispatchKernelFeatures::debugFlags;
+    }
+    if (partitionCount > 1) {
+        features |= EncodeDispatchKernelFeatures::implicitScaling;
+    }
+    return features;
+}
+
 template <typename Family>
 void *EncodeDispatchKernel<Family>::getInterfaceDescriptor(CommandContainer &container, IndirectHeap *childDsh, uint32_t &iddOffset) {
 
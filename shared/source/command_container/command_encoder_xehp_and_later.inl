@@ -27,6 +27,7 @@
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_template_cache.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -46,13 +47,15 @@ void EncodeDispatchKernel<Family>::setGrfInfo(InterfaceDescriptorType *pInterfac
 }
 
 template <typename Family>
-template <typename WalkerType>
+template <typename WalkerType, uint32_t features>
 void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDispatchKernelArgs &args) {
     using SHARED_LOCAL_MEMORY_SIZE = typename WalkerType::InterfaceDescriptorType::SHARED_LOCAL_MEMORY_SIZE;
     using STATE_BASE_ADDRESS = typename Family::STATE_BASE_ADDRESS;
     using POSTSYNC_DATA = std::remove_reference_t<std::invoke_result_t<decltype(&WalkerType::getPostSync), WalkerType &>>;
 
     constexpr bool heaplessModeEnabled = Family::template isHeaplessMode<WalkerType>();
+    constexpr bool debugFlagsEnabled = (features & EncodeDispatchKernelFeatures::debugFlags) != 0;
+    constexpr bool implicitScalingEnabled = (features & EncodeDispatchKernelFeatures::implicitScaling) != 0;
     const HardwareInfo &hwInfo = args.device->getHardwareInfo();
     auto &rootDeviceEnvironment = args.device->getRootDeviceEnvironment();
 
@@ -80,49 +83,78 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     WalkerType walkerCmd = Family::template getInitGpuWalker<WalkerType>();
     auto &idd = walkerCmd.getInterfaceDescriptor();
 
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, rootDeviceEnvironment);
-
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
     bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
+    uint64_t kernelStartPointer = 0u;
     {
         auto alloc = args.dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
 
         if constexpr (heaplessModeEnabled) {
-            auto address = alloc->getGpuAddress() + args.dispatchInterface->getIsaOffsetInParentAllocation();
-            if (!localIdsGenerationByRuntime) {
-                address += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
-            }
-            idd.setKernelStartPointer(address);
+            kernelStartPointer = alloc->getGpuAddress() + args.dispatchInterface->getIsaOffsetInParentAllocation();
         } else {
-            auto offset = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
-            if (!localIdsGenerationByRuntime) {
-                offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
-            }
-            idd.setKernelStartPointer(offset);
+            kernelStartPointer = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
+        }
+        if (!localIdsGenerationByRuntime) {
+            kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
         }
-    }
-    if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
-        idd.setSoftwareExceptionEnable(1);
     }
 
     auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
+    auto dispatchTemplateCache = args.dispatchInterface->getDispatchTemplateCache();
+    DispatchTemplateCache::Key dispatchTemplateKey{};
+    bool dispatchTemplateRestored = false;
+    if (dispatchTemplateCache) {
+        auto groupSize = args.dispatchInterface->getGroupSize();
+        dispatchTemplateKey.kernelStartPointer = kernelStartPointer;
+        dispatchTemplateKey.groupSize[0] = groupSize[0];
+        dispatchTemplateKey.groupSize[1] = groupSize[1];
+        dispatchTemplateKey.groupSize[2] = groupSize[2];
+        dispatchTemplateKey.slmTotalSize = args.dispatchInterface->getSlmTotalSize();
+        dispatchTemplateKey.threadsPerThreadGroup = threadsPerThreadGroup;
+        dispatchTemplateKey.slmPolicy = args.dispatchInterface->getSlmPolicy();
+        dispatchTemplateKey.preemptionMode = args.preemptionMode;
+        dispatchTemplateRestored = dispatchTemplateCache->restoreTemplate(dispatchTemplateKey, &idd, sizeof(idd));
+    }
+
+    if (!dispatchTemplateRestored) {
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, rootDeviceEnvironment);
+
+        idd.setKernelStartPointer(kernelStartPointer);
+        if (kernelDescriptor.kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
+            idd.setSoftwareExceptionEnable(1);
+        }
 
-    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
-    auto slmSize = static_cast<uint32_t>(
-        gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+        idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+
+        auto slmSize = static_cast<uint32_t>(
+            gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+
+        if constexpr (debugFlagsEnabled) {
+            if (debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+                slmSize = static_cast<uint32_t>(debugManager.flags.OverrideSlmAllocationSize.get());
+            }
+        }
+        idd.setSharedLocalMemorySize(slmSize);
+
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
 
-    if (debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
-        slmSize = static_cast<uint32_t>(debugManager.flags.OverrideSlmAllocationSize.get());
+        EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
+                                                                args.dispatchInterface->getSlmTotalSize(),
+                                                                args.dispatchInterface->getSlmPolicy());
+
+        if (dispatchTemplateCache) {
+            dispatchTemplateCache->storeTemplate(dispatchTemplateKey, &idd, sizeof(idd));
+        }
     }
-    idd.setSharedLocalMemorySize(slmSize);
 
     auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     bool sshProgrammingRequired = true;
@@ -191,8 +223,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
-
     uint32_t samplerCount = 0;
 
     if constexpr (Family::supportsSampler && heaplessModeEnabled == false) {
@@ -241,7 +271,16 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
     uint32_t sizeForImplicitArgsPatching = NEO::ImplicitArgsHelper::getSizeForImplicitArgsPatching(pImplicitArgs, kernelDescriptor, !localIdsGenerationByRuntime, gfxCoreHelper);
     uint32_t iohRequiredSize = sizeThreadData + sizeForImplicitArgsPatching;
-    {
+
+    // implicit args and indirect dispatch patch heap position dependent values into the indirect data
+    auto indirectDataCache = container.getIndirectDataCache();
+    bool indirectDataReusable = indirectDataCache && !pImplicitArgs && !args.isIndirect;
+    auto perThreadData = args.dispatchInterface->getPerThreadData();
+    IndirectDataBlock indirectData{crossThreadData, sizeCrossThreadData, perThreadData, perThreadData ? sizePerThreadDataForWholeGroup : 0u};
+    bool indirectDataReused = indirectDataReusable &&
+                              indirectDataCache->reuse(args.dispatchInterface, *container.getIndirectHeap(HeapType::indirectObject), indirectData, offsetThreadData);
+
+    if (!indirectDataReused) {
         auto heap = container.getIndirectHeap(HeapType::indirectObject);
         UNRECOVERABLE_IF(!heap);
         heap->align(DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
@@ -274,11 +313,17 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             EncodeIndirectParams<Family>::encode(container, gpuPtr, args.dispatchInterface, implicitArgsGpuPtr);
         }
 
-        auto perThreadDataPtr = args.dispatchInterface->getPerThreadData();
-        if (perThreadDataPtr != nullptr) {
+        if (perThreadData != nullptr) {
             ptr = ptrOffset(ptr, sizeCrossThreadData);
             memcpy_s(ptr, sizePerThreadDataForWholeGroup,
-                     perThreadDataPtr, sizePerThreadDataForWholeGroup);
+                     perThreadData, sizePerThreadDataForWholeGroup);
+        }
+
+        if (indirectDataCache) {
+            indirectDataCache->recordWrite(iohRequiredSize);
+            if (indirectDataReusable) {
+                indirectDataCache->store(args.dispatchInterface, *heap, indirectData, offsetThreadData);
+            }
         }
     }
 
@@ -312,11 +357,13 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         container.setDirtyStateForAllHeaps(false);
     }
 
-    if (NEO::PauseOnGpuProperties::pauseModeAllowed(NEO::debugManager.flags.PauseOnEnqueue.get(), args.device->debugExecutionCounter.load(), NEO::PauseOnGpuProperties::PauseMode::BeforeWorkload)) {
-        void *commandBuffer = listCmdBufferStream->getSpace(MemorySynchronizationCommands<Family>::getSizeForBarrierWithPostSyncOperation(args.device->getRootDeviceEnvironment(), false));
-        args.additionalCommands->push_back(commandBuffer);
+    if constexpr (debugFlagsEnabled) {
+        if (NEO::PauseOnGpuProperties::pauseModeAllowed(NEO::debugManager.flags.PauseOnEnqueue.get(), args.device->debugExecutionCounter.load(), NEO::PauseOnGpuProperties::PauseMode::BeforeWorkload)) {
+            void *commandBuffer = listCmdBufferStream->getSpace(MemorySynchronizationCommands<Family>::getSizeForBarrierWithPostSyncOperation(args.device->getRootDeviceEnvironment(), false));
+            args.additionalCommands->push_back(commandBuffer);
 
-        EncodeSemaphore<Family>::applyMiSemaphoreWaitCommand(*listCmdBufferStream, *args.additionalCommands);
+            EncodeSemaphore<Family>::applyMiSemaphoreWaitCommand(*listCmdBufferStream, *args.additionalCommands);
+        }
     }
 
     if constexpr (heaplessModeEnabled) {
@@ -351,34 +398,34 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         EncodeDispatchKernel<Family>::setupPostSyncForRegularEvent<WalkerType>(walkerCmd, args);
     }
 
-    if (debugManager.flags.ForceComputeWalkerPostSyncFlush.get() == 1) {
-        auto &postSync = walkerCmd.getPostSync();
-        postSync.setDataportPipelineFlush(true);
-        postSync.setDataportSubsliceCacheFlush(true);
+    if constexpr (debugFlagsEnabled) {
+        if (debugManager.flags.ForceComputeWalkerPostSyncFlush.get() == 1) {
+            auto &postSync = walkerCmd.getPostSync();
+            postSync.setDataportPipelineFlush(true);
+            postSync.setDataportSubsliceCacheFlush(true);
+        }
     }
 
     walkerCmd.setPredicateEnable(args.isPredicate);
 
     auto threadGroupCount = walkerCmd.getThreadGroupIdXDimension() * walkerCmd.getThreadGroupIdYDimension() * walkerCmd.getThreadGroupIdZDimension();
     EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(idd, *args.device, hwInfo, threadGroupCount, kernelDescriptor.kernelAttributes.numGrfRequired, walkerCmd);
-    if (debugManager.flags.PrintKernelDispatchParameters.get()) {
-        fprintf(stdout, "kernel, %s, numGrf, %d, simdSize, %d, tilesCount, %d, implicitScaling, %s, threadGroupCount, %d, numberOfThreadsInGpgpuThreadGroup, %d, threadGroupDimensions, %d, %d, %d, threadGroupDispatchSize enum, %d\n",
-                kernelDescriptor.kernelMetadata.kernelName.c_str(),
-                kernelDescriptor.kernelAttributes.numGrfRequired,
-                kernelDescriptor.kernelAttributes.simdSize,
-                args.device->getNumSubDevices(),
-                ImplicitScalingHelper::isImplicitScalingEnabled(args.device->getDeviceBitfield(), true) ? "Yes" : "no",
-                threadGroupCount,
-                idd.getNumberOfThreadsInGpgpuThreadGroup(),
-                walkerCmd.getThreadGroupIdXDimension(),
-                walkerCmd.getThreadGroupIdYDimension(),
-                walkerCmd.getThreadGroupIdZDimension(),
-                idd.getThreadGroupDispatchSize());
-    }
-
-    EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
-                                                            args.dispatchInterface->getSlmTotalSize(),
-                                                            args.dispatchInterface->getSlmPolicy());
+    if constexpr (debugFlagsEnabled) {
+        if (debugManager.flags.PrintKernelDispatchParameters.get()) {
+            fprintf(stdout, "kernel, %s, numGrf, %d, simdSize, %d, tilesCount, %d, implicitScaling, %s, threadGroupCount, %d, numberOfThreadsInGpgpuThreadGroup, %d, threadGroupDimensions, %d, %d, %d, threadGroupDispatchSize enum, %d\n",
+                    kernelDescriptor.kernelMetadata.kernelName.c_str(),
+                    kernelDescriptor.kernelAttributes.numGrfRequired,
+                    kernelDescriptor.kernelAttributes.simdSize,
+                    args.device->getNumSubDevices(),
+                    ImplicitScalingHelper::isImplicitScalingEnabled(args.device->getDeviceBitfield(), true) ? "Yes" : "no",
+                    threadGroupCount,
+                    idd.getNumberOfThreadsInGpgpuThreadGroup(),
+                    walkerCmd.getThreadGroupIdXDimension(),
+                    walkerCmd.getThreadGroupIdYDimension(),
+                    walkerCmd.getThreadGroupIdZDimension(),
+                    idd.getThreadGroupDispatchSize());
+        }
+    }
 
     EncodeWalkerArgs walkerArgs{
         args.isCooperative ? KernelExecutionType::concurrent : KernelExecutionType::defaultType,
@@ -391,7 +438,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     PreemptionHelper::applyPreemptionWaCmdsBegin<Family>(listCmdBufferStream, *args.device);
 
-    if (args.partitionCount > 1 && !args.isInternal) {
+    if (implicitScalingEnabled && args.partitionCount > 1 && !args.isInternal) {
         const uint64_t workPartitionAllocationGpuVa = args.device->getDefaultEngine().commandStreamReceiver->getWorkPartitionAllocationGpuAddress();
 
         ImplicitScalingDispatch<Family>::dispatchCommands(*listCmdBufferStream,
@@ -415,11 +462,13 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
 
-    if (NEO::PauseOnGpuProperties::pauseModeAllowed(NEO::debugManager.flags.PauseOnEnqueue.get(), args.device->debugExecutionCounter.load(), NEO::PauseOnGpuProperties::PauseMode::AfterWorkload)) {
-        void *commandBuffer = listCmdBufferStream->getSpace(MemorySynchronizationCommands<Family>::getSizeForBarrierWithPostSyncOperation(rootDeviceEnvironment, false));
-        args.additionalCommands->push_back(commandBuffer);
+    if constexpr (debugFlagsEnabled) {
+        if (NEO::PauseOnGpuProperties::pauseModeAllowed(NEO::debugManager.flags.PauseOnEnqueue.get(), args.device->debugExecutionCounter.load(), NEO::PauseOnGpuProperties::PauseMode::AfterWorkload)) {
+            void *commandBuffer = listCmdBufferStream->getSpace(MemorySynchronizationCommands<Family>::getSizeForBarrierWithPostSyncOperation(rootDeviceEnvironment, false));
+            args.additionalCommands->push_back(commandBuffer);
 
-        EncodeSemaphore<Family>::applyMiSemaphoreWaitCommand(*listCmdBufferStream, *args.additionalCommands);
+            EncodeSemaphore<Family>::applyMiSemaphoreWaitCommand(*listCmdBufferStream, *args.additionalCommands);
+        }
     }
 }
 
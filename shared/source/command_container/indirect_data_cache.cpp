@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/indirect_data_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
+
+#include <cstring>
+
+namespace NEO {
+
+bool IndirectDataCache::matches(const std::vector<uint8_t> &cachedData, const IndirectDataBlock &indirectData) {
+    if (cachedData.size() != indirectData.getSize()) {
+        return false;
+    }
+    if (indirectData.crossThreadDataSize > 0 &&
+        std::memcmp(cachedData.data(), indirectData.crossThreadData, indirectData.crossThreadDataSize) != 0) {
+        return false;
+    }
+    return indirectData.perThreadDataSize == 0 ||
+           std::memcmp(cachedData.data() + indirectData.crossThreadDataSize, indirectData.perThreadData, indirectData.perThreadDataSize) == 0;
+}
+
+bool IndirectDataCache::reuse(const void *dispatchKey, const IndirectHeap &heap, const IndirectDataBlock &indirectData, uint64_t &offsetThreadData) {
+    auto entry = entries.find(dispatchKey);
+    if (entry == entries.end() ||
+        entry->second.heapAllocation != heap.getGraphicsAllocation() ||
+        entry->second.heapUsedAfterWrite > heap.getUsed() ||
+        !matches(entry->second.data, indirectData)) {
+        return false;
+    }
+
+    lruList.splice(lruList.begin(), lruList, entry->second.lruPosition);
+    offsetThreadData = entry->second.offsetThreadData;
+    lastLaunchBytesWritten = 0u;
+    totalBytesReused += indirectData.getSize();
+    reusedLaunchesCount++;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintIndirectDataUploadSize.get() == 1, stdout,
+                       "Indirect data: 0 bytes written, %u bytes reused\n", indirectData.getSize());
+    return true;
+}
+
+void IndirectDataCache::store(const void *dispatchKey, const IndirectHeap &heap, const IndirectDataBlock &indirectData, uint64_t offsetThreadData) {
+    auto cached = entries.find(dispatchKey);
+    if (cached != entries.end()) {
+        lruList.splice(lruList.begin(), lruList, cached->second.lruPosition);
+    } else {
+        if (entries.size() >= maxEntriesCount) {
+            entries.erase(lruList.back());
+            lruList.pop_back();
+        }
+        lruList.push_front(dispatchKey);
+        cached = entries.emplace(dispatchKey, Entry{}).first;
+        cached->second.lruPosition = lruList.begin();
+    }
+
+    auto &entry = cached->second;
+    entry.heapAllocation = heap.getGraphicsAllocation();
+    entry.offsetThreadData = offsetThreadData;
+    entry.heapUsedAfterWrite = heap.getUsed();
+    entry.data.resize(indirectData.getSize());
+    if (indirectData.crossThreadDataSize > 0) {
+        std::memcpy(entry.data.data(), indirectData.crossThreadData, indirectData.crossThreadDataSize);
+    }
+    if (indirectData.perThreadDataSize > 0) {
+        std::memcpy(entry.data.data() + indirectData.crossThreadDataSize, indirectData.perThreadData, indirectData.perThreadDataSize);
+    }
+}
+
+void IndirectDataCache::recordWrite(size_t bytesWritten) {
+    lastLaunchBytesWritten = bytesWritten;
+    totalBytesWritten += bytesWritten;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintIndirectDataUploadSize.get() == 1, stdout,
+                       "Indirect data: %zu bytes written\n", bytesWritten);
+}
+
+void IndirectDataCache::clear() {
+    entries.clear();
+    lruList.clear();
+}
+
+} // namespace NEO
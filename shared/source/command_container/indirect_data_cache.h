@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class IndirectHeap;
+
+// Indirect data of a single dispatch as written to the indirect object heap: cross thread data followed by per thread data.
+struct IndirectDataBlock {
+    const void *crossThreadData = nullptr;
+    uint32_t crossThreadDataSize = 0u;
+    const void *perThreadData = nullptr;
+    uint32_t perThreadDataSize = 0u;
+
+    uint32_t getSize() const { return crossThreadDataSize + perThreadDataSize; }
+};
+
+// Remembers the last indirect data emitted per dispatch interface, so a launch with unchanged data points at the copy
+// already in the heap instead of writing it again. Entries refer to the current indirect object heap allocation only,
+// the cache is cleared whenever that heap is replaced (old allocations are recycled once their task count completes)
+// or reset together with the command container. Dispatch interfaces are only used as keys and may be destroyed while
+// their entry is cached, so the number of entries is bounded and the least recently used ones are dropped.
+class IndirectDataCache {
+  public:
+    static constexpr size_t defaultMaxEntriesCount = 64u;
+
+    struct Entry {
+        const GraphicsAllocation *heapAllocation = nullptr;
+        uint64_t offsetThreadData = 0u;
+        size_t heapUsedAfterWrite = 0u;
+        std::vector<uint8_t> data;
+        std::list<const void *>::iterator lruPosition;
+    };
+
+    explicit IndirectDataCache(size_t maxEntriesCount = defaultMaxEntriesCount) : maxEntriesCount(maxEntriesCount) {}
+
+    bool reuse(const void *dispatchKey, const IndirectHeap &heap, const IndirectDataBlock &indirectData, uint64_t &offsetThreadData);
+    void store(const void *dispatchKey, const IndirectHeap &heap, const IndirectDataBlock &indirectData, uint64_t offsetThreadData);
+    void recordWrite(size_t bytesWritten);
+    void clear();
+
+    size_t getLastLaunchBytesWritten() const { return lastLaunchBytesWritten; }
+    uint64_t getTotalBytesWritten() const { return totalBytesWritten; }
+    uint64_t getTotalBytesReused() const { return totalBytesReused; }
+    uint64_t getReusedLaunchesCount() const { return reusedLaunchesCount; }
+    size_t getEntriesCount() const { return entries.size(); }
+
+  protected:
+    static bool matches(const std::vector<uint8_t> &cachedData, const IndirectDataBlock &indirectData);
+
+    const size_t maxEntriesCount;
+    std::unordered_map<const void *, Entry> entries;
+    std::list<const void *> lruList;
+    size_t lastLaunchBytesWritten = 0u;
+    uint64_t totalBytesWritten = 0u;
+    uint64_t totalBytesReused = 0u;
+    uint64_t reusedLaunchesCount = 0u;
+};
+
+} // namespace NEO
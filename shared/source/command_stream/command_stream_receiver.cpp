@@ -10,6 +10,7 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/aub_subcapture_status.h"
+#include "shared/source/command_stream/completion_monitor.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
@@ -44,6 +45,7 @@
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/hw_timestamps.h"
 #include "shared/source/utilities/perf_counter.h"
+#include "shared/source/utilities/submission_tracer.h"
 #include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 
@@ -103,6 +105,8 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    completionMonitor.reset();
+
     if (userPauseConfirmation) {
         {
             std::unique_lock<SpinLock> lock{debugPauseStateLock};
@@ -458,13 +462,31 @@ WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams
         }
     }
 
-    auto retCode = baseWaitFunction(getTagAddress(), params, taskCountToWait);
+    WaitStatus retCode;
+    {
+        SubmissionTraceScope traceScope(SubmissionStage::hostWait);
+        if (debugManager.flags.EnableCompletionMonitor.get() == 1 && !params.indefinitelyPoll) {
+            if (this->latestFlushedTaskCount < taskCountToWait && this->flushTagUpdate() != NEO::SubmissionStatus::success) {
+                return WaitStatus::notReady;
+            }
+            retCode = getCompletionMonitor()->waitForTaskCount(params, taskCountToWait);
+        } else {
+            retCode = baseWaitFunction(getTagAddress(), params, taskCountToWait);
+        }
+    }
     if (printWaitForCompletion) {
         printTagAddressContent(taskCountToWait, params.waitTimeout, false);
     }
     return retCode;
 }
 
+CompletionMonitor *CommandStreamReceiver::getCompletionMonitor() {
+    std::call_once(completionMonitorCreated, [this]() {
+        completionMonitor = std::make_unique<CompletionMonitor>(*this);
+    });
+    return completionMonitor.get();
+}
+
 bool CommandStreamReceiver::checkGpuHangDetected(TimeType currentTime, TimeType &lastHangCheckTime) const {
     std::chrono::microseconds elapsedTimeSinceGpuHangCheck = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime);
 
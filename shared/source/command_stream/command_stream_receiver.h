@@ -15,6 +15,7 @@
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/utilities/spinlock.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include "aubstream/allocation_params.h"
 
@@ -22,12 +23,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 
 enum class AllocationType;
 enum class DebugPauseState : uint32_t;
 struct BatchBuffer;
+class CompletionMonitor;
 struct HardwareInfo;
 struct WaitParams;
 class SubmissionAggregator;
@@ -377,6 +380,9 @@ class CommandStreamReceiver {
 
     uint64_t getCompletionAddress() const;
 
+    WaitUtils::CompletionTimeEstimator &getCompletionTimeEstimator() { return completionTimeEstimator; }
+    CompletionMonitor *getCompletionMonitor();
+
     TaskCountType getCompletionValue(const GraphicsAllocation &gfxAllocation);
     DispatchMode getDispatchMode() const {
         return this->dispatchMode;
@@ -473,6 +479,7 @@ class CommandStreamReceiver {
     std::unique_ptr<TagAllocatorBase> timestampPacketAllocator;
     std::unique_ptr<Thread> userPauseConfirmation;
     std::unique_ptr<IndirectHeap> globalStatelessHeap;
+    std::unique_ptr<CompletionMonitor> completionMonitor;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -481,6 +488,7 @@ class CommandStreamReceiver {
     MutexType ownershipMutex;
     MutexType hostPtrSurfaceCreationMutex;
     MutexType registeredClientsMutex;
+    std::once_flag completionMonitorCreated;
     ExecutionEnvironment &executionEnvironment;
 
     LinearStream commandStream;
@@ -496,6 +504,7 @@ class CommandStreamReceiver {
     volatile TagAddressType *barrierCountTagAddress = nullptr;
     volatile DebugPauseState *debugPauseStateAddress = nullptr;
     SpinLock debugPauseStateLock;
+    WaitUtils::CompletionTimeEstimator completionTimeEstimator;
     static void *asyncDebugBreakConfirmation(void *arg);
     static std::function<void()> debugConfirmationFunction;
     std::function<void(GraphicsAllocation &)> downloadAllocationImpl;
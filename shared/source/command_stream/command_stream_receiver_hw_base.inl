@@ -44,6 +44,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/submission_tracer.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "command_stream_receiver_hw_ext.inl"
@@ -262,6 +263,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushImmediateTask(
     size_t immediateCommandStreamStart,
     ImmediateDispatchFlags &dispatchFlags,
     Device &device) {
+    SubmissionTraceScope traceScope(SubmissionStage::flushImmediateTask);
 
     ImmediateFlushData flushData;
     flushData.pipelineSelectFullConfigurationNeeded = !getPreambleSetFlag();
@@ -344,6 +346,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     TaskCountType taskLevel,
     DispatchFlags &dispatchFlags,
     Device &device) {
+    SubmissionTraceScope traceScope(SubmissionStage::flushTask);
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
     using MI_BATCH_BUFFER_END = typename GfxFamily::MI_BATCH_BUFFER_END;
     using PIPE_CONTROL = typename GfxFamily::PIPE_CONTROL;
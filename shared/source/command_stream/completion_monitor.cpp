@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/completion_monitor.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/wait_util.h"
+
+#include <chrono>
+
+namespace NEO {
+
+CompletionMonitor::CompletionMonitor(CommandStreamReceiver &csr) : csr(csr) {}
+
+CompletionMonitor::~CompletionMonitor() {
+    closeThread();
+}
+
+WaitStatus CompletionMonitor::waitForTaskCount(const WaitParams &params, TaskCountType taskCountToWait) {
+    if (csr.testTaskCountReady(csr.getTagAddress(), taskCountToWait)) {
+        return WaitStatus::ready;
+    }
+
+    Waiter waiter;
+    std::unique_lock<std::mutex> lock(monitorMtx);
+    // Create on first use
+    openThread();
+
+    auto position = waiters.emplace(taskCountToWait, &waiter);
+    monitorCond.notify_one();
+
+    auto isSignaled = [&waiter]() { return waiter.signaled; };
+    if (params.enableTimeout) {
+        waiter.condition.wait_for(lock, std::chrono::microseconds(params.waitTimeout), isSignaled);
+    } else {
+        waiter.condition.wait(lock, isSignaled);
+    }
+
+    if (!waiter.signaled) {
+        waiters.erase(position);
+    }
+    return waiter.status;
+}
+
+void CompletionMonitor::signalWaiters(WaitersContainer::iterator end, WaitStatus status) {
+    for (auto it = waiters.begin(); it != end; it++) {
+        it->second->status = status;
+        it->second->signaled = true;
+        it->second->condition.notify_one();
+    }
+    waiters.erase(waiters.begin(), end);
+}
+
+void *CompletionMonitor::monitorProcess(void *arg) {
+    auto self = reinterpret_cast<CompletionMonitor *>(arg);
+    auto &csr = self->csr;
+    std::unique_lock<std::mutex> lock(self->monitorMtx, std::defer_lock);
+
+    TaskCountType lowestTaskCount = 0;
+    auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    std::unique_ptr<WaitUtils::HybridWaitPolicy> waitPolicy;
+
+    while (true) {
+        lock.lock();
+        if (!self->allowMonitorProcess) {
+            break;
+        }
+        if (self->waiters.empty()) {
+            waitPolicy.reset();
+            self->monitorCond.wait(lock);
+            lock.unlock();
+            continue;
+        }
+
+        if (!waitPolicy || self->waiters.begin()->first != lowestTaskCount) {
+            lowestTaskCount = self->waiters.begin()->first;
+            waitStartTime = std::chrono::high_resolution_clock::now();
+            waitPolicy = std::make_unique<WaitUtils::HybridWaitPolicy>(csr.getCompletionTimeEstimator());
+        }
+        lock.unlock();
+
+        self->pollsCount++;
+        if (csr.testTaskCountReady(csr.getTagAddress(), lowestTaskCount)) {
+            lock.lock();
+            // wake every waiter that is already satisfied, in task count order
+            auto end = self->waiters.begin();
+            while (end != self->waiters.end() && (end->first <= lowestTaskCount || csr.testTaskCountReady(csr.getTagAddress(), end->first))) {
+                end++;
+            }
+            self->signalWaiters(end, WaitStatus::ready);
+            lock.unlock();
+            waitPolicy.reset();
+            continue;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        if (csr.checkGpuHangDetected(currentTime, lastHangCheckTime)) {
+            lock.lock();
+            self->signalWaiters(self->waiters.end(), WaitStatus::gpuHang);
+            lock.unlock();
+            continue;
+        }
+
+        auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+        waitPolicy->wait(csr.getTagAddress(), static_cast<uint64_t>(elapsedNs));
+    }
+    return nullptr;
+}
+
+void CompletionMonitor::closeThread() {
+    std::unique_lock<std::mutex> lock(monitorMtx);
+    if (allowMonitorProcess) {
+        allowMonitorProcess = false;
+        monitorCond.notify_one();
+        lock.unlock();
+        thread->join();
+        thread.reset(nullptr);
+        lock.lock();
+    }
+    UNRECOVERABLE_IF(!waiters.empty());
+}
+
+void CompletionMonitor::openThread() {
+    if (!thread.get()) {
+        DEBUG_BREAK_IF(allowMonitorProcess);
+        allowMonitorProcess = true;
+        thread = Thread::create(monitorProcess, reinterpret_cast<void *>(this));
+    }
+}
+
+size_t CompletionMonitor::getWaitersCount() {
+    std::lock_guard<std::mutex> lock(monitorMtx);
+    return waiters.size();
+}
+
+} // namespace NEO
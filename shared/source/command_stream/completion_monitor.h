@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+// Polls the tag of a single command stream receiver on behalf of all host threads waiting on it.
+// Waiters are kept sorted by task count and only the lowest outstanding one is polled, so
+// N blocked waiters cost one polling thread instead of N spinning ones.
+class CompletionMonitor {
+  public:
+    CompletionMonitor(CommandStreamReceiver &csr);
+    MOCKABLE_VIRTUAL ~CompletionMonitor();
+
+    WaitStatus waitForTaskCount(const WaitParams &params, TaskCountType taskCountToWait);
+    void closeThread();
+
+    size_t getWaitersCount();
+    uint64_t getPollsCount() const { return pollsCount.load(); }
+
+  protected:
+    struct Waiter {
+        std::condition_variable condition;
+        WaitStatus status = WaitStatus::notReady;
+        bool signaled = false;
+    };
+    using WaitersContainer = std::multimap<TaskCountType, Waiter *>;
+
+    static void *monitorProcess(void *arg);
+    MOCKABLE_VIRTUAL void openThread();
+    void signalWaiters(WaitersContainer::iterator end, WaitStatus status);
+
+    CommandStreamReceiver &csr;
+    WaitersContainer waiters;
+    std::unique_ptr<Thread> thread;
+    std::mutex monitorMtx;
+    std::condition_variable monitorCond;
+    std::atomic<uint64_t> pollsCount{0};
+    bool allowMonitorProcess = false;
+};
+} // namespace NEO
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/staging_transfer_engine.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/blit_helper.h"
+#include "shared/source/helpers/blit_properties.h"
+#include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NEO {
+
+namespace {
+uint64_t getCurrentNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+StagingTransferEngine::StagingTransferEngine(Device &device) : device(device) {
+    if (debugManager.flags.StagingTransferChunkSize.get() > 0) {
+        chunkSize = alignUp(static_cast<size_t>(debugManager.flags.StagingTransferChunkSize.get()), MemoryConstants::pageSize);
+    }
+}
+
+StagingTransferEngine::~StagingTransferEngine() {
+    for (auto &stagingBuffer : stagingBuffers) {
+        if (stagingBuffer.allocation) {
+            device.getMemoryManager()->freeGraphicsMemory(stagingBuffer.allocation);
+        }
+    }
+}
+
+bool StagingTransferEngine::isEnabled() {
+    return debugManager.flags.EnableStagingTransfers.get() == 1;
+}
+
+bool StagingTransferEngine::prepare(CommandStreamReceiver &bcsCsr) {
+    if (!bcsCsr.initializeResources()) {
+        return false;
+    }
+    bcsCsr.initDirectSubmission();
+
+    for (auto &stagingBuffer : stagingBuffers) {
+        if (stagingBuffer.allocation == nullptr) {
+            AllocationProperties properties{device.getRootDeviceIndex(), chunkSize, AllocationType::bufferHostMemory, device.getDeviceBitfield()};
+            stagingBuffer.allocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+            if (stagingBuffer.allocation == nullptr) {
+                return false;
+            }
+        }
+    }
+    currentStats = {};
+    return true;
+}
+
+TaskCountType StagingTransferEngine::submitChunk(CommandStreamReceiver &bcsCsr, GraphicsAllocation *dstAllocation, size_t dstOffset,
+                                                 GraphicsAllocation *srcAllocation, size_t srcOffset, size_t size, bool blocking) {
+    BlitPropertiesContainer blitPropertiesContainer;
+    blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForCopy(dstAllocation, srcAllocation,
+                                                                                 {dstOffset, 0, 0}, {srcOffset, 0, 0}, {size, 1, 1},
+                                                                                 0, 0, 0, 0, bcsCsr.getClearColorAllocation()));
+    auto taskCount = bcsCsr.flushBcsTask(blitPropertiesContainer, blocking, false, device);
+    if (taskCount < CompletionStamp::notReady) {
+        currentStats.chunks++;
+    }
+    return taskCount;
+}
+
+WaitStatus StagingTransferEngine::waitForStagingBuffer(CommandStreamReceiver &bcsCsr, StagingBuffer &stagingBuffer) {
+    if (stagingBuffer.taskCount == 0) {
+        return WaitStatus::ready;
+    }
+    const auto waitStart = getCurrentNs();
+    // non-blocking blits do not update the tag when it is updated from wait
+    if (bcsCsr.peekLatestFlushedTaskCount() < stagingBuffer.taskCount) {
+        bcsCsr.flushTagUpdate();
+    }
+    auto waitStatus = bcsCsr.waitForTaskCount(stagingBuffer.taskCount);
+    currentStats.gpuWaitNs += getCurrentNs() - waitStart;
+    stagingBuffer.taskCount = 0;
+    return waitStatus;
+}
+
+BlitOperationResult StagingTransferEngine::write(CommandStreamReceiver &bcsCsr, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *hostPtr, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!prepare(bcsCsr)) {
+        return BlitOperationResult::fail;
+    }
+    const auto transferStart = getCurrentNs();
+
+    TaskCountType taskCount = 0;
+    size_t chunk = 0;
+    for (size_t offset = 0; offset < size; offset += chunkSize, chunk++) {
+        auto &stagingBuffer = stagingBuffers[chunk % stagingBuffersCount];
+        if (waitForStagingBuffer(bcsCsr, stagingBuffer) == WaitStatus::gpuHang) {
+            taskCount = CompletionStamp::gpuHang;
+            break;
+        }
+
+        const auto chunkBytes = std::min(chunkSize, size - offset);
+        const auto copyStart = getCurrentNs();
+        memcpy_s(stagingBuffer.allocation->getUnderlyingBuffer(), chunkSize, ptrOffset(hostPtr, offset), chunkBytes);
+        currentStats.cpuCopyNs += getCurrentNs() - copyStart;
+
+        const bool lastChunk = (offset + chunkBytes == size);
+        taskCount = submitChunk(bcsCsr, dstAllocation, dstOffset + offset, stagingBuffer.allocation, 0, chunkBytes, lastChunk);
+        if (taskCount >= CompletionStamp::notReady) {
+            break;
+        }
+        stagingBuffer.taskCount = lastChunk ? 0 : taskCount;
+    }
+
+    for (auto &stagingBuffer : stagingBuffers) {
+        waitForStagingBuffer(bcsCsr, stagingBuffer);
+    }
+    currentStats.bytes = size;
+    finishTransfer("write", transferStart);
+    return getResult(taskCount);
+}
+
+BlitOperationResult StagingTransferEngine::read(CommandStreamReceiver &bcsCsr, GraphicsAllocation *srcAllocation, size_t srcOffset, void *hostPtr, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!prepare(bcsCsr)) {
+        return BlitOperationResult::fail;
+    }
+    const auto transferStart = getCurrentNs();
+    const auto chunksCount = Math::divideAndRoundUp(size, chunkSize);
+
+    TaskCountType taskCount = 0;
+    auto submitRead = [&](size_t chunk) {
+        auto &stagingBuffer = stagingBuffers[chunk % stagingBuffersCount];
+        const auto offset = chunk * chunkSize;
+        taskCount = submitChunk(bcsCsr, stagingBuffer.allocation, 0, srcAllocation, srcOffset + offset, std::min(chunkSize, size - offset), false);
+        stagingBuffer.taskCount = taskCount < CompletionStamp::notReady ? taskCount : 0;
+    };
+
+    for (size_t chunk = 0; chunk < std::min<size_t>(stagingBuffersCount, chunksCount) && taskCount < CompletionStamp::notReady; chunk++) {
+        submitRead(chunk);
+    }
+    for (size_t chunk = 0; chunk < chunksCount && taskCount < CompletionStamp::notReady; chunk++) {
+        auto &stagingBuffer = stagingBuffers[chunk % stagingBuffersCount];
+        if (waitForStagingBuffer(bcsCsr, stagingBuffer) == WaitStatus::gpuHang) {
+            taskCount = CompletionStamp::gpuHang;
+            break;
+        }
+
+        const auto offset = chunk * chunkSize;
+        const auto chunkBytes = std::min(chunkSize, size - offset);
+        const auto copyStart = getCurrentNs();
+        memcpy_s(ptrOffset(hostPtr, offset), chunkBytes, stagingBuffer.allocation->getUnderlyingBuffer(), chunkBytes);
+        currentStats.cpuCopyNs += getCurrentNs() - copyStart;
+
+        if (chunk + stagingBuffersCount < chunksCount) {
+            submitRead(chunk + stagingBuffersCount);
+        }
+    }
+
+    for (auto &stagingBuffer : stagingBuffers) {
+        waitForStagingBuffer(bcsCsr, stagingBuffer);
+    }
+    currentStats.bytes = size;
+    finishTransfer("read", transferStart);
+    return getResult(taskCount);
+}
+
+void StagingTransferEngine::finishTransfer(const char *directionName, uint64_t startNs) {
+    currentStats.totalNs = getCurrentNs() - startNs;
+    lastTransferStats = currentStats;
+
+    auto bytesPerNs = [](uint64_t bytes, uint64_t ns) { return ns ? static_cast<double>(bytes) / static_cast<double>(ns) : 0.0; };
+    PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout,
+                       "Staging %s of %llu bytes in %u chunks: cpu copy %.2f GB/s, gpu wait %llu ns, total %.2f GB/s\n",
+                       directionName, static_cast<unsigned long long>(currentStats.bytes), currentStats.chunks,
+                       bytesPerNs(currentStats.bytes, currentStats.cpuCopyNs), static_cast<unsigned long long>(currentStats.gpuWaitNs),
+                       bytesPerNs(currentStats.bytes, currentStats.totalNs));
+}
+
+BlitOperationResult StagingTransferEngine::getResult(TaskCountType taskCount) {
+    if (taskCount == CompletionStamp::gpuHang) {
+        return BlitOperationResult::gpuHang;
+    }
+    return taskCount < CompletionStamp::notReady ? BlitOperationResult::success : BlitOperationResult::fail;
+}
+
+StagingTransferStats StagingTransferEngine::getLastTransferStats() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return lastTransferStats;
+}
+
+} // namespace NEO
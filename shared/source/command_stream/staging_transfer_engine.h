@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/source/helpers/constants.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Device;
+class GraphicsAllocation;
+enum class BlitOperationResult;
+
+struct StagingTransferStats {
+    uint64_t bytes = 0;
+    uint32_t chunks = 0;
+    uint64_t cpuCopyNs = 0;
+    uint64_t gpuWaitNs = 0;
+    uint64_t totalNs = 0;
+};
+
+// Streams transfers between unpinned host memory and a GPU allocation through a small ring of staging
+// buffers, so the host range is never pinned and the CPU copy of one chunk overlaps with the copy engine
+// transfer of another. Each transfer is complete when the call returns.
+class StagingTransferEngine {
+  public:
+    static constexpr uint32_t stagingBuffersCount = 3;
+    static constexpr size_t defaultChunkSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t minChunksCount = 4;
+
+    StagingTransferEngine(Device &device);
+    ~StagingTransferEngine();
+
+    static bool isEnabled();
+    bool isTransferSizeSupported(size_t size) const { return size >= minChunksCount * chunkSize; }
+
+    BlitOperationResult write(CommandStreamReceiver &bcsCsr, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *hostPtr, size_t size);
+    BlitOperationResult read(CommandStreamReceiver &bcsCsr, GraphicsAllocation *srcAllocation, size_t srcOffset, void *hostPtr, size_t size);
+
+    StagingTransferStats getLastTransferStats() const;
+    size_t getChunkSize() const { return chunkSize; }
+
+  protected:
+    struct StagingBuffer {
+        GraphicsAllocation *allocation = nullptr;
+        TaskCountType taskCount = 0;
+    };
+
+    bool prepare(CommandStreamReceiver &bcsCsr);
+    TaskCountType submitChunk(CommandStreamReceiver &bcsCsr, GraphicsAllocation *dstAllocation, size_t dstOffset,
+                              GraphicsAllocation *srcAllocation, size_t srcOffset, size_t size, bool blocking);
+    WaitStatus waitForStagingBuffer(CommandStreamReceiver &bcsCsr, StagingBuffer &stagingBuffer);
+    void finishTransfer(const char *directionName, uint64_t startNs);
+    static BlitOperationResult getResult(TaskCountType taskCount);
+
+    Device &device;
+    size_t chunkSize = defaultChunkSize;
+    std::array<StagingBuffer, stagingBuffersCount> stagingBuffers;
+    StagingTransferStats currentStats;
+    StagingTransferStats lastTransferStats;
+    mutable std::mutex mtx;
+};
+
+} // namespace NEO
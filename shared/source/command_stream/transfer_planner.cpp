@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/transfer_planner.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace NEO {
+
+TransferCost TransferCostModel::getCost(TransferPath path, TransferDirection direction) const {
+    switch (path) {
+    case TransferPath::cpu:
+        switch (direction) {
+        case TransferDirection::hostToLocal:
+            return {1000u, 4.0};
+        case TransferDirection::localToHost:
+            // reads through an uncached mapping
+            return {1000u, 0.25};
+        case TransferDirection::localToLocal:
+            return {1000u, 0.2};
+        default:
+            return {500u, 8.0};
+        }
+    case TransferPath::copyEngine:
+        return {15000u, direction == TransferDirection::localToLocal ? 40.0 : 20.0};
+    case TransferPath::computeKernel:
+        return {20000u, direction == TransferDirection::localToLocal ? 200.0 : 20.0};
+    default:
+        UNRECOVERABLE_IF(true);
+        return {};
+    }
+}
+
+TransferPlanner::TransferPlanner() : TransferPlanner(std::make_unique<TransferCostModel>()) {}
+
+TransferPlanner::TransferPlanner(std::unique_ptr<TransferCostModel> &&costModel) : costModel(std::move(costModel)) {
+    for (auto &correction : corrections) {
+        correction.store(1.0, std::memory_order_relaxed);
+    }
+}
+
+uint32_t TransferPlanner::getSizeBucket(size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    return std::min(Math::log2(static_cast<uint64_t>(size)), sizeBucketsCount - 1);
+}
+
+uint32_t TransferPlanner::getCorrectionIndex(TransferPath path, TransferDirection direction, size_t size) {
+    return (static_cast<uint32_t>(path) * directionsCount + static_cast<uint32_t>(direction)) * sizeBucketsCount + getSizeBucket(size);
+}
+
+std::atomic<double> &TransferPlanner::correctionFor(TransferPath path, TransferDirection direction, size_t size) {
+    return corrections[getCorrectionIndex(path, direction, size)];
+}
+
+const std::atomic<double> &TransferPlanner::correctionFor(TransferPath path, TransferDirection direction, size_t size) const {
+    return corrections[getCorrectionIndex(path, direction, size)];
+}
+
+double TransferPlanner::getCorrection(TransferPath path, TransferDirection direction, size_t size) const {
+    return correctionFor(path, direction, size).load(std::memory_order_relaxed);
+}
+
+uint64_t TransferPlanner::estimateNs(TransferPath path, TransferDirection direction, size_t size) const {
+    auto cost = costModel->getCost(path, direction);
+    auto predictedNs = static_cast<double>(cost.latencyNs) + static_cast<double>(size) / cost.bytesPerNs;
+    return static_cast<uint64_t>(predictedNs * getCorrection(path, direction, size));
+}
+
+void TransferPlanner::recordTransfer(TransferPath path, TransferDirection direction, size_t size, uint64_t observedNs) {
+    auto cost = costModel->getCost(path, direction);
+    auto predictedNs = static_cast<double>(cost.latencyNs) + static_cast<double>(size) / cost.bytesPerNs;
+    auto observedRatio = static_cast<double>(observedNs) / std::max(predictedNs, 1.0);
+
+    auto &correction = correctionFor(path, direction, size);
+    auto current = correction.load(std::memory_order_relaxed);
+    while (!correction.compare_exchange_weak(current, current + (observedRatio - current) * correctionWeight, std::memory_order_relaxed)) {
+    }
+    observationsCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+TransferPlan TransferPlanner::plan(TransferDirection direction, size_t size, uint32_t availablePathsMask, bool allowSplit) const {
+    TransferPlan bestPlan;
+    bestPlan.primarySize = size;
+
+    for (uint32_t path = 0; path < pathsCount; path++) {
+        if (!(availablePathsMask & getTransferPathMask(static_cast<TransferPath>(path)))) {
+            continue;
+        }
+        auto estimatedNs = estimateNs(static_cast<TransferPath>(path), direction, size);
+        if (bestPlan.primaryPath == TransferPath::count || estimatedNs < bestPlan.estimatedNs) {
+            bestPlan.primaryPath = static_cast<TransferPath>(path);
+            bestPlan.estimatedNs = estimatedNs;
+        }
+    }
+
+    if (bestPlan.primaryPath == TransferPath::count) {
+        return bestPlan;
+    }
+
+    auto planIndex = plansCount.fetch_add(1, std::memory_order_relaxed);
+    if ((planIndex + 1) % explorationPeriod == 0) {
+        auto explorationPlan = getExplorationPlan(direction, size, availablePathsMask, bestPlan, planIndex / explorationPeriod);
+        if (explorationPlan.primaryPath != TransferPath::count) {
+            return explorationPlan;
+        }
+    }
+
+    if (!allowSplit || size < 2 * minSplitSize) {
+        return bestPlan;
+    }
+
+    auto splitPlan = bestPlan;
+    for (uint32_t first = 0; first < pathsCount; first++) {
+        for (uint32_t second = first + 1; second < pathsCount; second++) {
+            auto firstPath = static_cast<TransferPath>(first);
+            auto secondPath = static_cast<TransferPath>(second);
+            if (!(availablePathsMask & getTransferPathMask(firstPath)) || !(availablePathsMask & getTransferPathMask(secondPath))) {
+                continue;
+            }
+
+            // both parts finish at the same time: L1 + f * S * r1 = L2 + (1 - f) * S * r2
+            auto firstCost = costModel->getCost(firstPath, direction);
+            auto secondCost = costModel->getCost(secondPath, direction);
+            auto firstCorrection = getCorrection(firstPath, direction, size);
+            auto secondCorrection = getCorrection(secondPath, direction, size);
+            auto firstLatency = firstCost.latencyNs * firstCorrection;
+            auto secondLatency = secondCost.latencyNs * secondCorrection;
+            auto firstRate = firstCorrection / firstCost.bytesPerNs;
+            auto secondRate = secondCorrection / secondCost.bytesPerNs;
+            auto totalSize = static_cast<double>(size);
+
+            auto fraction = (secondLatency - firstLatency + totalSize * secondRate) / (totalSize * (firstRate + secondRate));
+            auto firstSize = static_cast<size_t>(std::clamp(fraction, 0.0, 1.0) * totalSize);
+            if (firstSize < minSplitSize || size - firstSize < minSplitSize) {
+                continue;
+            }
+
+            auto estimatedNs = std::max(estimateNs(firstPath, direction, firstSize), estimateNs(secondPath, direction, size - firstSize));
+            if (estimatedNs < splitPlan.estimatedNs) {
+                splitPlan.primaryPath = firstPath;
+                splitPlan.secondaryPath = secondPath;
+                splitPlan.primarySize = firstSize;
+                splitPlan.estimatedNs = estimatedNs;
+            }
+        }
+    }
+
+    if (splitPlan.isSplit() && static_cast<double>(splitPlan.estimatedNs) < static_cast<double>(bestPlan.estimatedNs) * splitGainThreshold) {
+        return splitPlan;
+    }
+    return bestPlan;
+}
+
+TransferPlan TransferPlanner::getExplorationPlan(TransferDirection direction, size_t size, uint32_t availablePathsMask, const TransferPlan &bestPlan, uint64_t explorationRound) const {
+    // candidates are visited round robin, paths estimated to be much slower are not tried to bound the cost of exploring
+    TransferPlan candidates[pathsCount];
+    uint32_t candidatesCount = 0;
+    for (uint32_t path = 0; path < pathsCount; path++) {
+        auto transferPath = static_cast<TransferPath>(path);
+        if (transferPath == bestPlan.primaryPath || !(availablePathsMask & getTransferPathMask(transferPath))) {
+            continue;
+        }
+        auto estimatedNs = estimateNs(transferPath, direction, size);
+        if (static_cast<double>(estimatedNs) <= static_cast<double>(bestPlan.estimatedNs) * maxExplorationSlowdown) {
+            candidates[candidatesCount].primaryPath = transferPath;
+            candidates[candidatesCount].primarySize = size;
+            candidates[candidatesCount].estimatedNs = estimatedNs;
+            candidatesCount++;
+        }
+    }
+
+    if (candidatesCount == 0) {
+        return {};
+    }
+    return candidates[explorationRound % candidatesCount];
+}
+
+} // namespace NEO
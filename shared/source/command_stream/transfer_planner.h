@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/transfer_direction.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+enum class TransferPath : uint32_t {
+    cpu = 0,
+    copyEngine,
+    computeKernel,
+    count
+};
+
+inline constexpr uint32_t getTransferPathMask(TransferPath path) {
+    return 1u << static_cast<uint32_t>(path);
+}
+
+struct TransferCost {
+    uint64_t latencyNs = 0;
+    double bytesPerNs = 1.0;
+};
+
+// Prior cost of each path, used until real transfers have been observed.
+class TransferCostModel {
+  public:
+    virtual ~TransferCostModel() = default;
+    virtual TransferCost getCost(TransferPath path, TransferDirection direction) const;
+};
+
+struct TransferPlan {
+    TransferPath primaryPath = TransferPath::count;
+    TransferPath secondaryPath = TransferPath::count;
+    size_t primarySize = 0;
+    uint64_t estimatedNs = 0;
+
+    bool isSplit() const { return secondaryPath != TransferPath::count; }
+};
+
+// Picks the fastest transfer path, or a split between two paths, from a prior linear cost model
+// (latency + size / bandwidth) corrected online by the ratio of observed to predicted duration.
+// Corrections are tracked per path, direction and power-of-two size bucket. Only executed paths are observed, so every
+// explorationPeriod-th plan picks another path whose estimate is not far off, letting its correction follow the hardware.
+class TransferPlanner {
+  public:
+    static constexpr uint32_t pathsCount = static_cast<uint32_t>(TransferPath::count);
+    static constexpr uint32_t directionsCount = 4;
+    static constexpr uint32_t sizeBucketsCount = 40;
+    static constexpr size_t minSplitSize = 64 * 1024;
+    static constexpr double splitGainThreshold = 0.9;
+    static constexpr double correctionWeight = 0.125;
+    static constexpr uint64_t explorationPeriod = 64;
+    static constexpr double maxExplorationSlowdown = 4.0;
+
+    TransferPlanner();
+    TransferPlanner(std::unique_ptr<TransferCostModel> &&costModel);
+
+    static uint32_t getSizeBucket(size_t size);
+
+    uint64_t estimateNs(TransferPath path, TransferDirection direction, size_t size) const;
+    TransferPlan plan(TransferDirection direction, size_t size, uint32_t availablePathsMask, bool allowSplit) const;
+    void recordTransfer(TransferPath path, TransferDirection direction, size_t size, uint64_t observedNs);
+
+    double getCorrection(TransferPath path, TransferDirection direction, size_t size) const;
+    uint64_t getObservationsCount() const { return observationsCount.load(std::memory_order_relaxed); }
+
+  protected:
+    static uint32_t getCorrectionIndex(TransferPath path, TransferDirection direction, size_t size);
+    std::atomic<double> &correctionFor(TransferPath path, TransferDirection direction, size_t size);
+    const std::atomic<double> &correctionFor(TransferPath path, TransferDirection direction, size_t size) const;
+    TransferPlan getExplorationPlan(TransferDirection direction, size_t size, uint32_t availablePathsMask, const TransferPlan &bestPlan, uint64_t explorationRound) const;
+
+    std::unique_ptr<TransferCostModel> costModel;
+    std::array<std::atomic<double>, pathsCount * directionsCount * sizeBucketsCount> corrections;
+    std::atomic<uint64_t> observationsCount{0};
+    mutable std::atomic<uint64_t> plansCount{0};
+};
+
+} // namespace NEO
@@ -366,6 +366,35 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchTemplateCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, launch-invariant INTERFACE_DESCRIPTOR_DATA fields are encoded once per kernel and group size and reused on subsequent dispatches")
+DECLARE_DEBUG_VARIABLE(int32_t, SetAmountOfCmdBuffersToPrewarm, -1, "-1: default, 0:disabled, > 0: enabled. If enabled, driver allocates given amount of command buffers at L0 device creation and places them in the device reusable allocation list shared by all command lists")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBindlessSurfaceStateReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, bindless surface state kept per allocation is encoded once and reused across setArg calls while the programmed buffer address, size and caching stay the same")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSubmissionTracing, -1, "-1: default (disabled), 0: disabled, 1: record per-stage submission latency histograms (argument patching, dispatch encoding, residency, flush, ring append, host wait), 2: record and print histograms at process exit")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListLoadBalancing, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, immediate command lists created on a compute group with multiple engines are bound to the engine with the fewest outstanding tasks instead of the requested index")
+DECLARE_DEBUG_VARIABLE(int32_t, PageFaultManagerMigrationNeighbourhood, -1, "-1: default (disabled), 0: disabled, >0: on a CPU page fault also migrate up to given number of adjacent shared allocations on each side that are in GPU domain, unprotecting each contiguous address range with a single call")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHybridEventWait, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, event host synchronize spins for the expected completion time tracked per command stream receiver, then uses umonitor/umwait (if enabled) or yield, then backs off with exponentially growing sleeps")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCompletionMonitor, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, host waits on a command stream receiver are served by a single per-CSR completion monitor thread polling the tag for all waiters")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStreamingCpuCopy, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, CPU copies to and from locked device memory use non-temporal stores and streaming loads and large copies are split across worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyParallelThreshold, -1, "-1: default (8MB), 0: never split, >0: size in bytes from which CPU copies with EnableStreamingCpuCopy are split across worker threads")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyMaxThreads, -1, "-1: default (4), >0: maximal number of threads used for a single CPU copy with EnableStreamingCpuCopy")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTransferPlanner, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, immediate command lists choose between CPU copy and GPU copy from a cost model refined with observed transfer times instead of fixed size thresholds")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveBcsSplit, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, BCS split sizes chunks by measured engine bandwidth and queue depth, skips busy engines and auto-tunes the split threshold")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventArena, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, storage of small single-device event pools is sub-allocated from per-device event slabs instead of a dedicated allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrImportCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, immediate command lists keep external host pointer allocations in a per-device LRU cache and reuse them for later copies from the same host range")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrImportCacheBudgetMB, -1, "-1: default (256), >0: maximal size in MB of host memory kept pinned by the host pointer import cache")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStagingTransfers, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, large blocking copy engine transfers between device memory and unpinned host memory are streamed through a ring of staging buffers instead of pinning the host range")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingTransferChunkSize, -1, "-1: default (2MB), >0: size in bytes of a single staging buffer used by staging transfers, aligned up to page size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedLocalIdsCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, local IDs generated by the runtime are kept in a device-wide cache shared by all kernels with the same SIMD, GRF size, dimension order and group size")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedLocalIdsCacheBudgetKB, -1, "-1: default (4096), >0: maximal size in KB of local ID data kept by the device-wide local IDs cache")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableOccupancyWorkGroupSizeSuggestion, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, zeKernelSuggestGroupSize picks the group size keeping most work items resident per subslice, based on SLM, barriers and GRF mode")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStreamingPrintfFormatter, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, output of consecutive printf calls is formatted into a single buffer and printed with one write")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncPrintfOutput, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, Level Zero kernel printf output is formatted and printed on a background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinsPreloadInBackground, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled and builtins are initialized asynchronously, all builtin kernels are loaded in the background at device creation and each builtin is waited for separately on first use")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGenericFillKernel, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, fills with patterns up to 128 bytes that would need split launches or have non power of 2 size use single generic fill kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableFillPatternReduction, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, fill pattern is reduced to its shortest repeating unit before selecting copy engine or kernel fill path")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIndirectDataReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, command container reuses indirect data already written to indirect object heap when kernel is dispatched again with unchanged data")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintIndirectDataUploadSize, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, prints bytes of indirect data written or reused per kernel dispatch")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSpecializedDispatchEncoders, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, command list selects at creation a kernel dispatch encoder compiled without checks for features it does not use, e.g. debug flags or implicit scaling")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/command_stream/staging_transfer_engine.h"
 #include "shared/source/command_stream/submission_status.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/debugger/debugger_l0.h"
@@ -20,6 +21,7 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/ray_tracing_helper.h"
+#include "shared/source/kernel/shared_local_ids_cache.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/driver_info.h"
@@ -68,6 +70,8 @@ Device::~Device() {
     subdevices.clear();
 
     syncBufferHandler.reset();
+    stagingTransferEngine.reset();
+    sharedLocalIdsCache.reset();
     commandStreamReceivers.clear();
     executionEnvironment->memoryManager->waitForDeletions();
 
@@ -699,6 +703,24 @@ void Device::allocateSyncBufferHandler() {
     }
 }
 
+StagingTransferEngine *Device::getStagingTransferEngine() {
+    static std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    if (stagingTransferEngine.get() == nullptr) {
+        stagingTransferEngine = std::make_unique<StagingTransferEngine>(*this);
+    }
+    return stagingTransferEngine.get();
+}
+
+SharedLocalIdsCache *Device::getSharedLocalIdsCache() {
+    static std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    if (sharedLocalIdsCache.get() == nullptr) {
+        sharedLocalIdsCache = std::make_unique<SharedLocalIdsCache>(SharedLocalIdsCache::getBudgetFromDebugFlags());
+    }
+    return sharedLocalIdsCache.get();
+}
+
 uint64_t Device::getGlobalMemorySize(uint32_t deviceBitfield) const {
     auto globalMemorySize = getMemoryManager()->isLocalMemorySupported(this->getRootDeviceIndex())
                                 ? getMemoryManager()->getLocalMemorySize(this->getRootDeviceIndex(), deviceBitfield)
@@ -26,6 +26,8 @@ class ExecutionEnvironment;
 class Debugger;
 class GmmClientContext;
 class GmmHelper;
+class SharedLocalIdsCache;
+class StagingTransferEngine;
 class SyncBufferHandler;
 enum class EngineGroupType : uint32_t;
 class DebuggerL0;
@@ -144,6 +146,8 @@ class Device : public ReferenceTrackedObject<Device> {
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
     void allocateSyncBufferHandler();
+    StagingTransferEngine *getStagingTransferEngine();
+    SharedLocalIdsCache *getSharedLocalIdsCache();
 
     uint32_t getRootDeviceIndex() const {
         return this->rootDeviceIndex;
@@ -162,6 +166,8 @@ class Device : public ReferenceTrackedObject<Device> {
 
     static decltype(&PerformanceCounters::create) createPerformanceCountersFunc;
     std::unique_ptr<SyncBufferHandler> syncBufferHandler;
+    std::unique_ptr<StagingTransferEngine> stagingTransferEngine;
+    std::unique_ptr<SharedLocalIdsCache> sharedLocalIdsCache;
     GraphicsAllocation *getRTMemoryBackedBuffer() { return rtMemoryBackedBuffer; }
     RTDispatchGlobalsInfo *getRTDispatchGlobals(uint32_t maxBvhLevels);
     bool rayTracingIsInitialized() const { return rtMemoryBackedBuffer != nullptr; }
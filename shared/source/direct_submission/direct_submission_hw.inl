@@ -31,6 +31,7 @@
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/submission_tracer.h"
 
 #include "create_direct_submission_hw.inl"
 
@@ -927,6 +928,7 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchUllsState() {
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
+    SubmissionTraceScope traceScope(SubmissionStage::ringAppend);
     if (batchBuffer.ringBufferRestartRequest) {
         this->stopRingBuffer(false);
     }
@@ -16,6 +16,7 @@
 #include "shared/source/helpers/driver_model_type.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/memcpy_engine.h"
 #include "shared/source/helpers/string_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
@@ -120,6 +121,14 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+MemcpyThreadPool *ExecutionEnvironment::getMemcpyThreadPool() {
+    std::lock_guard<std::mutex> lockForInit(initializeMemcpyThreadPoolMutex);
+    if (this->memcpyThreadPool == nullptr) {
+        this->memcpyThreadPool = std::make_unique<MemcpyThreadPool>();
+    }
+    return memcpyThreadPool.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
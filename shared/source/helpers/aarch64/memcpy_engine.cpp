@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/memcpy_engine.h"
+
+namespace NEO {
+
+MemcpyEngine::CopyFunctionT MemcpyEngine::copyWithStreamingStores = MemcpyEngine::copyCacheable;
+MemcpyEngine::CopyFunctionT MemcpyEngine::copyWithStreamingLoads = MemcpyEngine::copyCacheable;
+
+MemcpyEngine::MemcpyEngine() {
+}
+
+MemcpyEngine MemcpyEngine::initializer;
+
+} // namespace NEO
@@ -111,6 +111,7 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
                     surfaceStateInHeapVectorReuse[allocatePoolIndex][otherSizeIndex].clear();
                 }
 
+                reusedSlotsCount++;
                 return surfaceStateFromVector;
             }
         }
@@ -163,6 +164,7 @@ bool BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
         return false;
     }
     ssHeapsAllocations.push_back(newAlloc);
+    heapGrowCount++;
     heap->replaceGraphicsAllocation(newAlloc);
     heap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                         newAlloc->getUnderlyingBufferSize());
@@ -11,6 +11,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -58,6 +59,24 @@ class BindlessHeapsHelper {
     bool getStateDirtyForContext(uint32_t osContextId);
     void clearStateDirtyForContext(uint32_t osContextId);
 
+    // Serializes checking, programming and recording the key of an allocation's pre-programmed surface state,
+    // so a key is never observed before its surface state is written.
+    std::unique_lock<std::mutex> obtainSurfaceStateReuseLock() {
+        return std::unique_lock<std::mutex>(surfaceStateReuseMtx);
+    }
+    void incrementReusedSurfaceStatesCount() {
+        reusedSurfaceStatesCount++;
+    }
+    uint64_t getReusedSurfaceStatesCount() const {
+        return reusedSurfaceStatesCount.load();
+    }
+    uint64_t getHeapGrowCount() const {
+        return heapGrowCount;
+    }
+    uint64_t getReusedSlotsCount() const {
+        return reusedSlotsCount;
+    }
+
   protected:
     const size_t surfaceStateSize;
     bool growHeap(BindlesHeapType heapType);
@@ -75,7 +94,12 @@ class BindlessHeapsHelper {
     std::array<std::vector<SurfaceStateInHeapInfo>, 2> surfaceStateInHeapVectorReuse[2];
     std::bitset<64> stateCacheDirtyForContext;
 
+    uint64_t heapGrowCount = 0;
+    uint64_t reusedSlotsCount = 0;
+    std::atomic<uint64_t> reusedSurfaceStatesCount{0};
+
     std::mutex mtx;
+    std::mutex surfaceStateReuseMtx;
     DeviceBitfield deviceBitfield;
     bool globalBindlessDsh = false;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,9 +47,15 @@ inline uint32_t getPerThreadSizeLocalIDs(uint32_t simd, uint32_t grfSize, uint32
 }
 
 struct LocalIDHelper {
+    using GenerateFunctionT = void (*)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+    using GenerateWithLayoutForImagesFunctionT = void (*)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd);
+    using GenerateForSimdOneFunctionT = void (*)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, const std::array<uint8_t, 3> &dimensionsOrder, uint32_t grfSize);
+
     static void (*generateSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
     static void (*generateSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
     static void (*generateSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+    static GenerateWithLayoutForImagesFunctionT generateWithLayoutForImages;
+    static GenerateForSimdOneFunctionT generateForSimdOne;
 
     static LocalIDHelper initializer;
 
@@ -59,6 +65,11 @@ struct LocalIDHelper {
 
 extern const uint16_t initialLocalID[];
 
+// x86_64 only, nullptr when the build compiler does not support AVX-512
+extern LocalIDHelper::GenerateFunctionT generateLocalIDsSimd32Avx512;
+extern LocalIDHelper::GenerateWithLayoutForImagesFunctionT generateLocalIDsWithLayoutForImagesAvx512;
+extern LocalIDHelper::GenerateForSimdOneFunctionT generateLocalIDsForSimdOneAvx512;
+
 template <typename Vec, int simd>
 void generateLocalIDsSimd(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
                           const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
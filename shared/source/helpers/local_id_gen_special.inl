@@ -21,7 +21,7 @@ bool isCompatibleWithLayoutForImages(const std::array<uint16_t, 3> &localWorkgro
            localWorkgroupSize.at(2) == 1u;
 }
 
-inline void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd) {
+void generateLocalIDsWithLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd) {
     uint8_t rowWidth = simd == 32u ? 32u : 16u;
     uint8_t xDelta = simd == 8u ? 2u : 4u;                                                    // difference between corresponding values in consecutive X rows
     uint8_t yDelta = (simd == 8u || localWorkgroupSize.at(1) == 4u) ? 4u : rowWidth / xDelta; // difference between corresponding values in consecutive Y rows
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/memcpy_engine.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+namespace NEO {
+
+void MemcpyEngine::copyCacheable(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+MemcpyEngine::CopyFunctionT MemcpyEngine::getCopyFunction(MemcpyHint hint, size_t size) {
+    if (size < minStreamingCopySize) {
+        return copyCacheable;
+    }
+    switch (hint) {
+    case MemcpyHint::writeCombinedDestination:
+        return copyWithStreamingStores;
+    case MemcpyHint::uncachedSource:
+        return copyWithStreamingLoads;
+    default:
+        return copyCacheable;
+    }
+}
+
+uint32_t MemcpyEngine::getCopyThreadsCount(size_t size) {
+    size_t parallelCopyThreshold = defaultParallelCopyThreshold;
+    if (debugManager.flags.CpuCopyParallelThreshold.get() != -1) {
+        parallelCopyThreshold = static_cast<size_t>(debugManager.flags.CpuCopyParallelThreshold.get());
+    }
+    uint32_t maxCopyThreads = defaultMaxCopyThreads;
+    if (debugManager.flags.CpuCopyMaxThreads.get() != -1) {
+        maxCopyThreads = static_cast<uint32_t>(debugManager.flags.CpuCopyMaxThreads.get());
+    }
+    maxCopyThreads = std::min(maxCopyThreads, std::max(std::thread::hardware_concurrency(), 1u));
+
+    if (parallelCopyThreshold == 0 || size < parallelCopyThreshold) {
+        return 1u;
+    }
+    // every thread gets at least half of the threshold, smaller chunks do not pay off thread start
+    auto chunks = size / std::max(parallelCopyThreshold / 2, MemoryConstants::cacheLineSize);
+    return static_cast<uint32_t>(std::clamp(chunks, static_cast<size_t>(1u), static_cast<size_t>(std::max(maxCopyThreads, 1u))));
+}
+
+void MemcpyEngine::copy(void *dst, const void *src, size_t size, MemcpyHint hint, MemcpyThreadPool *threadPool) {
+    auto copyFunction = getCopyFunction(hint, size);
+    auto threadsCount = getCopyThreadsCount(size);
+    if (threadsCount == 1 || threadPool == nullptr) {
+        copyFunction(dst, src, size);
+        return;
+    }
+    threadPool->copy(copyFunction, dst, src, size, threadsCount);
+}
+
+MemcpyThreadPool::CopyJob::CopyJob(MemcpyEngine::CopyFunctionT copyFunction, void *dst, const void *src, size_t size, size_t chunkSize)
+    : copyFunction(copyFunction), dst(dst), src(src), size(size), chunkSize(chunkSize), chunksCount((size + chunkSize - 1) / chunkSize) {}
+
+void MemcpyThreadPool::CopyJob::copyChunks() {
+    for (auto chunk = nextChunk++; chunk < chunksCount; chunk = nextChunk++) {
+        auto offset = chunk * chunkSize;
+        copyFunction(ptrOffset(dst, offset), ptrOffset(src, offset), std::min(chunkSize, size - offset));
+    }
+}
+
+MemcpyThreadPool::~MemcpyThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        shutdown = true;
+    }
+    workAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+size_t MemcpyThreadPool::getWorkersCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+}
+
+std::thread MemcpyThreadPool::startWorker() {
+    return std::thread(&MemcpyThreadPool::processJobs, this);
+}
+
+void MemcpyThreadPool::startWorkers(size_t count) {
+    if (workers.size() >= count || workerStartFailed) {
+        return;
+    }
+    workers.reserve(count);
+    while (workers.size() < count) {
+        try {
+            workers.push_back(startWorker());
+        } catch (const std::system_error &) {
+            // the copy proceeds with the workers started so far, or on the calling thread only
+            workerStartFailed = true;
+            return;
+        }
+    }
+}
+
+void MemcpyThreadPool::processJobs() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        workAvailable.wait(lock, [this]() { return shutdown || (currentJob != nullptr && currentJob->hasChunks()); });
+        if (shutdown) {
+            return;
+        }
+        auto job = currentJob;
+        job->workersCount++;
+        lock.unlock();
+
+        job->copyChunks();
+
+        lock.lock();
+        if (--job->workersCount == 0) {
+            jobDone.notify_all();
+        }
+    }
+}
+
+void MemcpyThreadPool::copy(MemcpyEngine::CopyFunctionT copyFunction, void *dst, const void *src, size_t size, uint32_t threadsCount) {
+    std::unique_lock<std::mutex> lock(mtx);
+    startWorkers(threadsCount - 1);
+    if (currentJob != nullptr || workers.empty()) {
+        lock.unlock();
+        copyFunction(dst, src, size);
+        return;
+    }
+
+    CopyJob job(copyFunction, dst, src, size, std::max(alignUp(size / threadsCount, MemoryConstants::pageSize), MemoryConstants::pageSize));
+    currentJob = &job;
+    lock.unlock();
+    workAvailable.notify_all();
+
+    job.copyChunks();
+
+    lock.lock();
+    currentJob = nullptr;
+    jobDone.wait(lock, [&job]() { return job.workersCount == 0; });
+}
+
+} // namespace NEO
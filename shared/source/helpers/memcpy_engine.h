@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+class MemcpyThreadPool;
+
+enum class MemcpyHint : uint32_t {
+    cacheable,
+    writeCombinedDestination,
+    uncachedSource
+};
+
+// CPU copy engine used for host copies to and from locked device memory.
+// Write-combined destinations are written with non-temporal stores and uncached sources are
+// read with streaming loads; large copies are split across the workers of the thread pool, when given.
+struct MemcpyEngine {
+    static constexpr size_t minStreamingCopySize = 4 * MemoryConstants::kiloByte;
+    static constexpr size_t defaultParallelCopyThreshold = 8 * MemoryConstants::megaByte;
+    static constexpr uint32_t defaultMaxCopyThreads = 4;
+
+    using CopyFunctionT = void (*)(void *dst, const void *src, size_t size);
+
+    static void copy(void *dst, const void *src, size_t size, MemcpyHint hint, MemcpyThreadPool *threadPool);
+    static CopyFunctionT getCopyFunction(MemcpyHint hint, size_t size);
+    static uint32_t getCopyThreadsCount(size_t size);
+
+    static void copyCacheable(void *dst, const void *src, size_t size);
+    static CopyFunctionT copyWithStreamingStores;
+    static CopyFunctionT copyWithStreamingLoads;
+
+    MemcpyEngine();
+    static MemcpyEngine initializer;
+};
+
+// Persistent workers sharing the chunks of a large copy with the calling thread.
+// Workers are started on the first parallel copy. One copy is split at a time; a copy issued while
+// the workers are busy, or when no worker could be started, runs on the calling thread only.
+class MemcpyThreadPool : NonCopyableOrMovableClass {
+  public:
+    MemcpyThreadPool() = default;
+    MOCKABLE_VIRTUAL ~MemcpyThreadPool();
+
+    void copy(MemcpyEngine::CopyFunctionT copyFunction, void *dst, const void *src, size_t size, uint32_t threadsCount);
+    size_t getWorkersCount();
+
+  protected:
+    struct CopyJob {
+        CopyJob(MemcpyEngine::CopyFunctionT copyFunction, void *dst, const void *src, size_t size, size_t chunkSize);
+        void copyChunks();
+        bool hasChunks() const { return nextChunk.load() < chunksCount; }
+
+        MemcpyEngine::CopyFunctionT copyFunction;
+        void *dst;
+        const void *src;
+        size_t size;
+        size_t chunkSize;
+        size_t chunksCount;
+        std::atomic<size_t> nextChunk{0};
+        uint32_t workersCount = 0;
+    };
+
+    MOCKABLE_VIRTUAL std::thread startWorker();
+    void startWorkers(size_t count);
+    void processJobs();
+
+    std::mutex mtx;
+    std::condition_variable workAvailable;
+    std::condition_variable jobDone;
+    std::vector<std::thread> workers;
+    CopyJob *currentJob = nullptr;
+    bool workerStartFailed = false;
+    bool shutdown = false;
+};
+
+void copyWithStreamingStoresAvx2(void *dst, const void *src, size_t size);
+void copyWithStreamingLoadsAvx2(void *dst, const void *src, size_t size);
+
+} // namespace NEO
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/occupancy_work_group_size.h"
+
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/kernel_helpers.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace NEO {
+
+OccupancyInfo OccupancyInfo::create(const KernelDescriptor &kernelDescriptor, const RootDeviceEnvironment &rootDeviceEnvironment,
+                                    uint32_t maxWorkGroupSize, uint32_t slmTotalSize) {
+    auto &hwInfo = *rootDeviceEnvironment.getHardwareInfo();
+    auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<GfxCoreHelper>();
+
+    OccupancyInfo occupancyInfo;
+    occupancyInfo.simdSize = std::max(1u, static_cast<uint32_t>(kernelDescriptor.kernelAttributes.simdSize));
+    occupancyInfo.maxWorkGroupSize = std::max(1u, maxWorkGroupSize);
+
+    auto dssCount = hwInfo.gtSystemInfo.DualSubSliceCount;
+    if (dssCount == 0) {
+        dssCount = hwInfo.gtSystemInfo.SubSliceCount;
+    }
+    occupancyInfo.dssCount = std::max(1u, dssCount);
+    occupancyInfo.availableThreadCount = gfxCoreHelper.calculateAvailableThreadCount(hwInfo, kernelDescriptor.kernelAttributes.numGrfRequired);
+
+    occupancyInfo.slmSizePerDss = static_cast<uint32_t>(hwInfo.capabilityTable.slmSize * MemoryConstants::kiloByte);
+    // SLM sizes exceeding the DSS cannot be aligned, they are kept as is so that no work group fits
+    occupancyInfo.usedSlmSize = (slmTotalSize > 0 && slmTotalSize <= occupancyInfo.slmSizePerDss) ? gfxCoreHelper.alignSlmSize(slmTotalSize) : slmTotalSize;
+    occupancyInfo.maxBarrierCount = static_cast<uint32_t>(gfxCoreHelper.getMaxBarrierRegisterPerSlice());
+    occupancyInfo.barriersCount = kernelDescriptor.kernelAttributes.barrierCount;
+    return occupancyInfo;
+}
+
+bool estimateOccupancy(const OccupancyInfo &occupancyInfo, const size_t workGroupSize[3], const size_t workItems[3], OccupancyEstimate &estimate) {
+    auto localSize = workGroupSize[0] * workGroupSize[1] * workGroupSize[2];
+    UNRECOVERABLE_IF(localSize == 0);
+
+    estimate.threadsPerWorkGroup = static_cast<uint32_t>(Math::divideAndRoundUp(localSize, occupancyInfo.simdSize));
+    // the SLM of a work group has to fit into a single DSS
+    estimate.maxResidentWorkGroups = occupancyInfo.usedSlmSize > occupancyInfo.slmSizePerDss
+                                         ? 0u
+                                         : KernelHelper::getMaxWorkGroupCount(occupancyInfo.simdSize, occupancyInfo.availableThreadCount, occupancyInfo.dssCount,
+                                                                              occupancyInfo.dssCount * occupancyInfo.slmSizePerDss, occupancyInfo.usedSlmSize,
+                                                                              occupancyInfo.maxBarrierCount, occupancyInfo.barriersCount, 3, workGroupSize);
+    if (estimate.maxResidentWorkGroups == 0) {
+        return false;
+    }
+
+    uint64_t workGroupsCount = 1;
+    for (uint32_t i = 0; i < 3; i++) {
+        workGroupsCount *= Math::divideAndRoundUp(workItems[i], workGroupSize[i]);
+    }
+    auto residentWorkGroups = std::min(workGroupsCount, static_cast<uint64_t>(estimate.maxResidentWorkGroups));
+
+    estimate.residentThreads = residentWorkGroups * estimate.threadsPerWorkGroup;
+    estimate.residentWorkItems = residentWorkGroups * localSize;
+    estimate.idleLanes = workGroupsCount * (static_cast<uint64_t>(estimate.threadsPerWorkGroup) * occupancyInfo.simdSize - localSize);
+    estimate.busySubslices = static_cast<uint32_t>(std::min(workGroupsCount, static_cast<uint64_t>(occupancyInfo.dssCount)));
+    return true;
+}
+
+namespace {
+void getDivisors(size_t value, size_t limit, StackVec<size_t, 64> &divisors) {
+    auto maxDivisor = std::min(value, limit);
+    for (size_t divisor = 1; divisor <= maxDivisor; divisor++) {
+        if (value % divisor == 0) {
+            divisors.push_back(divisor);
+        }
+    }
+}
+} // namespace
+
+bool suggestOccupancyWorkGroupSize(const OccupancyInfo &occupancyInfo, const size_t workItems[3], uint32_t workDim, size_t workGroupSize[3]) {
+    UNRECOVERABLE_IF(workDim == 0 || workDim > 3);
+
+    const size_t items[3] = {workItems[0], workDim > 1 ? workItems[1] : 1, workDim > 2 ? workItems[2] : 1};
+    StackVec<size_t, 64> divisors[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        getDivisors(std::max(items[i], static_cast<size_t>(1)), occupancyInfo.maxWorkGroupSize, divisors[i]);
+    }
+
+    bool found = false;
+    OccupancyEstimate best;
+    size_t bestSize[3] = {1, 1, 1};
+    auto isBetter = [](const OccupancyEstimate &lhs, const size_t lhsSize[3], const OccupancyEstimate &rhs, const size_t rhsSize[3]) {
+        auto lhsLocalSize = lhsSize[0] * lhsSize[1] * lhsSize[2];
+        auto rhsLocalSize = rhsSize[0] * rhsSize[1] * rhsSize[2];
+        return std::make_tuple(lhs.residentWorkItems, rhs.idleLanes, lhs.busySubslices, lhsLocalSize, lhsSize[0]) >
+               std::make_tuple(rhs.residentWorkItems, lhs.idleLanes, rhs.busySubslices, rhsLocalSize, rhsSize[0]);
+    };
+
+    for (auto z : divisors[2]) {
+        for (auto y : divisors[1]) {
+            if (y * z > occupancyInfo.maxWorkGroupSize) {
+                break;
+            }
+            for (auto x : divisors[0]) {
+                if (x * y * z > occupancyInfo.maxWorkGroupSize) {
+                    break;
+                }
+                const size_t candidate[3] = {x, y, z};
+                OccupancyEstimate estimate;
+                if (!estimateOccupancy(occupancyInfo, candidate, items, estimate)) {
+                    continue;
+                }
+                if (!found || isBetter(estimate, candidate, best, bestSize)) {
+                    found = true;
+                    best = estimate;
+                    std::copy(candidate, candidate + 3, bestSize);
+                }
+            }
+        }
+    }
+
+    if (found) {
+        std::copy(bestSize, bestSize + 3, workGroupSize);
+    }
+    return found;
+}
+
+} // namespace NEO
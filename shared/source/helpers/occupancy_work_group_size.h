@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+struct KernelDescriptor;
+struct RootDeviceEnvironment;
+
+// Resource model used to rank work group shapes by how many hardware threads they keep resident. Resident work
+// groups are counted by KernelHelper::getMaxWorkGroupCount, like for cooperative kernels.
+struct OccupancyInfo {
+    uint32_t simdSize = 1;
+    uint32_t maxWorkGroupSize = 1;
+    uint32_t dssCount = 1;
+    uint32_t availableThreadCount = 1;
+    uint32_t slmSizePerDss = 0;
+    uint32_t usedSlmSize = 0;
+    uint32_t maxBarrierCount = 0;
+    uint32_t barriersCount = 0;
+
+    static OccupancyInfo create(const KernelDescriptor &kernelDescriptor, const RootDeviceEnvironment &rootDeviceEnvironment,
+                                uint32_t maxWorkGroupSize, uint32_t slmTotalSize);
+};
+
+struct OccupancyEstimate {
+    uint32_t threadsPerWorkGroup = 0;
+    uint32_t maxResidentWorkGroups = 0;
+    uint64_t residentThreads = 0;
+    uint64_t residentWorkItems = 0;
+    uint64_t idleLanes = 0;
+    uint32_t busySubslices = 0;
+};
+
+// Returns false when no work group can be resident (e.g. SLM or barriers exceed the limits).
+bool estimateOccupancy(const OccupancyInfo &occupancyInfo, const size_t workGroupSize[3], const size_t workItems[3], OccupancyEstimate &estimate);
+
+// Enumerates work group shapes evenly dividing workItems and picks the one keeping most work items resident on
+// hardware threads, ties are broken by fewer idle SIMD lanes, more busy subslices, larger work groups and longer X extent.
+bool suggestOccupancyWorkGroupSize(const OccupancyInfo &occupancyInfo, const size_t workItems[3], uint32_t workDim, size_t workGroupSize[3]);
+
+} // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include <iterator>
@@ -51,6 +52,21 @@ void TimestampPacketContainer::moveNodesToNewContainer(TimestampPacketContainer
     timestampPacketContainer.assignAndIncrementNodesRefCounts(tempContainer);
 }
 
+void TimestampPacketHelper::convertTicksToNs(uint64_t *startEndPairs, size_t pairsCount, double resolution, uint32_t validBits) {
+    // Timestamps are masked to their valid bits and an end that wrapped past the counter width is moved one
+    // period forward, so end - start stays the real duration after conversion. Single pass without data
+    // dependent branches, so the loop is vectorized wherever the target has packed 64-bit to double conversions.
+    const uint64_t mask = maxNBitValue(validBits);
+    const uint64_t period = validBits < 64u ? mask + 1 : 0u;
+    for (size_t i = 0; i < pairsCount; i++) {
+        auto start = startEndPairs[2 * i] & mask;
+        auto end = startEndPairs[2 * i + 1] & mask;
+        end += end < start ? period : 0u;
+        startEndPairs[2 * i] = static_cast<uint64_t>(static_cast<double>(start) * resolution);
+        startEndPairs[2 * i + 1] = static_cast<uint64_t>(static_cast<double>(end) * resolution);
+    }
+}
+
 void TimestampPacketContainer::releaseNodes() {
     for (auto node : timestampPacketNodes) {
         node->returnTag();
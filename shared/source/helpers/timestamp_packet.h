@@ -92,6 +92,8 @@ struct TimestampPacketHelper {
         return timestampPacketNode.getGpuAddress() + timestampPacketNode.getGlobalStartOffset();
     }
 
+    static void convertTicksToNs(uint64_t *startEndPairs, size_t pairsCount, double resolution, uint32_t validBits);
+
     template <typename GfxFamily>
     static void programSemaphore(LinearStream &cmdStream, TagNodeBase &timestampPacketNode) {
         using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
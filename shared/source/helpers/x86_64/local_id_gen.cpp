@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,8 +21,8 @@ struct uint16x16_t;
 
 // This is the initial value of SIMD for local ID
 // computation.  It correlates to the SIMD lane.
-// Must be 32byte aligned for AVX2 usage
-ALIGNAS(32)
+// Must be 32byte aligned for AVX2 usage, AVX-512 loads a full SIMD32 row at once
+ALIGNAS(64)
 const uint16_t initialLocalID[] = {
     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
@@ -31,6 +31,8 @@ const uint16_t initialLocalID[] = {
 void (*LocalIDHelper::generateSimd8)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize) = generateLocalIDsSimd<uint16x8_t, 8>;
 void (*LocalIDHelper::generateSimd16)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize) = generateLocalIDsSimd<uint16x8_t, 16>;
 void (*LocalIDHelper::generateSimd32)(void *buffer, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize) = generateLocalIDsSimd<uint16x8_t, 32>;
+LocalIDHelper::GenerateWithLayoutForImagesFunctionT LocalIDHelper::generateWithLayoutForImages = generateLocalIDsWithLayoutForImages;
+LocalIDHelper::GenerateForSimdOneFunctionT LocalIDHelper::generateForSimdOne = generateLocalIDsForSimdOne;
 
 // Initialize the lookup table based on CPU capabilities
 LocalIDHelper::LocalIDHelper() {
@@ -40,6 +42,12 @@ LocalIDHelper::LocalIDHelper() {
         LocalIDHelper::generateSimd16 = generateLocalIDsSimd<uint16x16_t, 16>;
         LocalIDHelper::generateSimd32 = generateLocalIDsSimd<uint16x16_t, 32>;
     }
+    bool supportsAVX512 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512Bw);
+    if (supportsAVX512 && generateLocalIDsSimd32Avx512 != nullptr) {
+        LocalIDHelper::generateSimd32 = generateLocalIDsSimd32Avx512;
+        LocalIDHelper::generateWithLayoutForImages = generateLocalIDsWithLayoutForImagesAvx512;
+        LocalIDHelper::generateForSimdOne = generateLocalIDsForSimdOneAvx512;
+    }
 }
 
 LocalIDHelper LocalIDHelper::initializer;
@@ -50,7 +58,7 @@ void generateLocalIDs(void *buffer, uint16_t simd, const std::array<uint16_t, 3>
     auto threadsPerWorkGroup = static_cast<uint16_t>(gfxCoreHelper.calculateNumThreadsPerThreadGroup(simd, static_cast<uint32_t>(localWorkgroupSize[0] * localWorkgroupSize[1] * localWorkgroupSize[2]), grfSize, localIdsGeneratedByHw));
     bool useLayoutForImages = isImageOnlyKernel && isCompatibleWithLayoutForImages(localWorkgroupSize, dimensionsOrder, simd);
     if (useLayoutForImages) {
-        generateLocalIDsWithLayoutForImages(buffer, localWorkgroupSize, simd);
+        LocalIDHelper::generateWithLayoutForImages(buffer, localWorkgroupSize, simd);
     } else if (simd == 32) {
         LocalIDHelper::generateSimd32(buffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, grfSize != 32);
     } else if (simd == 16) {
@@ -58,7 +66,7 @@ void generateLocalIDs(void *buffer, uint16_t simd, const std::array<uint16_t, 3>
     } else if (simd == 8) {
         LocalIDHelper::generateSimd8(buffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, grfSize != 32);
     } else {
-        generateLocalIDsForSimdOne(buffer, localWorkgroupSize, dimensionsOrder, grfSize);
+        LocalIDHelper::generateForSimdOne(buffer, localWorkgroupSize, dimensionsOrder, grfSize);
     }
 }
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/local_id_gen.h"
+
+#if __AVX512F__ && __AVX512BW__
+#include "shared/source/helpers/local_id_gen.inl"
+#include "shared/source/helpers/uint16_avx512.h"
+
+#include <algorithm>
+#include <array>
+
+namespace NEO {
+template void generateLocalIDsSimd<uint16x32_t, 32>(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup, const std::array<uint8_t, 3> &dimensionsOrder, bool chooseMaxRowSize);
+
+namespace {
+// The layout for images walks tiles xDelta wide and 4 rows high (8 or 16 work items) column by column within
+// bands of rows, so every GRF is one tile (SIMD8, SIMD16) or two tiles (SIMD32). Lanes of a tile only add a
+// fixed pattern to the tile origin, the carries of the scalar walk are done once per tile.
+void generateLayoutForImages(void *b, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t simd) {
+    const uint16_t lwsX = localWorkgroupSize[0];
+    const uint16_t lwsY = localWorkgroupSize[1];
+    const uint32_t rowWidth = simd == 32u ? 32u : 16u;
+    const uint16_t xDelta = simd == 8u ? 2u : 4u;
+    const uint16_t tileHeight = 4u;
+    const uint16_t bandHeight = (simd == 8u || lwsY == 4u) ? 4u : static_cast<uint16_t>(rowWidth / xDelta);
+    const uint32_t tileSize = xDelta * tileHeight;
+
+    alignas(64) uint16_t tileX[32];
+    alignas(64) uint16_t tileY[32];
+    for (uint32_t lane = 0; lane < 32; lane++) {
+        tileX[lane] = static_cast<uint16_t>(lane % xDelta);
+        tileY[lane] = static_cast<uint16_t>((lane % tileSize) / xDelta);
+    }
+    const __m512i vTileX = _mm512_load_si512(tileX);
+    const __m512i vTileY = _mm512_load_si512(tileY);
+    const __mmask32 secondTile = simd == 32u ? 0xffff0000u : 0u;
+    const __mmask32 lanes = simd == 32u ? 0xffffffffu : ((1u << simd) - 1u);
+
+    uint16_t x = 0u;
+    uint16_t y = 0u;
+    uint16_t bandY = 0u;
+    uint16_t bandEnd = std::min<uint16_t>(bandHeight, lwsY);
+    auto nextTile = [&]() {
+        y += tileHeight;
+        if (y < bandEnd) {
+            return;
+        }
+        x += xDelta;
+        if (x == lwsX) {
+            x = 0u;
+            bandY += bandHeight;
+            if (bandY >= lwsY) {
+                bandY = 0u;
+            }
+            bandEnd = std::min<uint16_t>(bandY + bandHeight, lwsY);
+        }
+        y = bandY;
+    };
+
+    auto buffer = reinterpret_cast<uint16_t *>(b);
+    const auto numGrfs = (lwsX * lwsY * localWorkgroupSize[2] + (simd - 1)) / simd;
+    for (auto grfId = 0; grfId < numGrfs; grfId++) {
+        __m512i originX = _mm512_set1_epi16(x);
+        __m512i originY = _mm512_set1_epi16(y);
+        nextTile();
+        if (secondTile) {
+            originX = _mm512_mask_set1_epi16(originX, secondTile, x);
+            originY = _mm512_mask_set1_epi16(originY, secondTile, y);
+            nextTile();
+        }
+        _mm512_mask_storeu_epi16(buffer, lanes, _mm512_add_epi16(originX, vTileX));
+        _mm512_mask_storeu_epi16(buffer + rowWidth, lanes, _mm512_add_epi16(originY, vTileY));
+        _mm512_mask_storeu_epi16(buffer + 2 * rowWidth, lanes, _mm512_setzero_si512());
+        buffer += 3 * rowWidth;
+    }
+}
+
+// Each work item gets its own GRF holding x, y and z in the first three words. With 32 byte GRFs two work items
+// are written by one masked store, the words between them are left untouched like in the scalar walk.
+void generateSimdOne(void *b, const std::array<uint16_t, 3> &localWorkgroupSize,
+                     const std::array<uint8_t, 3> &dimensionsOrder, uint32_t grfSize) {
+    const uint16_t lwsX = localWorkgroupSize[dimensionsOrder[0]];
+    const uint16_t lwsY = localWorkgroupSize[dimensionsOrder[1]];
+    const uint16_t lwsZ = localWorkgroupSize[dimensionsOrder[2]];
+
+    const uint32_t itemsPerStore = grfSize == 32u ? 2u : 1u;
+    const __mmask32 firstItem = 0b111u;
+    const __mmask32 allItems = itemsPerStore == 2u ? (firstItem | (firstItem << 16)) : firstItem;
+    // second item of a store is the next x, its words start at lane 16
+    const __m512i nextItemX = _mm512_maskz_set1_epi16(1u << 16, 1);
+
+    auto buffer = reinterpret_cast<uint8_t *>(b);
+    const size_t storeStride = itemsPerStore * grfSize;
+    for (uint64_t z = 0; z < lwsZ; z++) {
+        for (uint64_t y = 0; y < lwsY; y++) {
+            const uint64_t yz = (y << 16) | (z << 32);
+            uint16_t x = 0;
+            for (; x + itemsPerStore <= lwsX; x += itemsPerStore) {
+                const __m512i ids = _mm512_add_epi16(_mm512_set1_epi64(static_cast<long long>(yz | x)), nextItemX);
+                _mm512_mask_storeu_epi16(buffer, allItems, ids);
+                buffer += storeStride;
+            }
+            if (x < lwsX) {
+                _mm512_mask_storeu_epi16(buffer, firstItem, _mm512_set1_epi64(static_cast<long long>(yz | x)));
+                buffer += grfSize;
+            }
+        }
+    }
+}
+
+} // namespace
+
+LocalIDHelper::GenerateFunctionT generateLocalIDsSimd32Avx512 = generateLocalIDsSimd<uint16x32_t, 32>;
+LocalIDHelper::GenerateWithLayoutForImagesFunctionT generateLocalIDsWithLayoutForImagesAvx512 = generateLayoutForImages;
+LocalIDHelper::GenerateForSimdOneFunctionT generateLocalIDsForSimdOneAvx512 = generateSimdOne;
+} // namespace NEO
+#else
+namespace NEO {
+LocalIDHelper::GenerateFunctionT generateLocalIDsSimd32Avx512 = nullptr;
+LocalIDHelper::GenerateWithLayoutForImagesFunctionT generateLocalIDsWithLayoutForImagesAvx512 = nullptr;
+LocalIDHelper::GenerateForSimdOneFunctionT generateLocalIDsForSimdOneAvx512 = nullptr;
+} // namespace NEO
+#endif
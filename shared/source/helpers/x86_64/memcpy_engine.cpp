@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/memcpy_engine.h"
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+MemcpyEngine::CopyFunctionT MemcpyEngine::copyWithStreamingStores = MemcpyEngine::copyCacheable;
+MemcpyEngine::CopyFunctionT MemcpyEngine::copyWithStreamingLoads = MemcpyEngine::copyCacheable;
+
+// Initialize the lookup table based on CPU capabilities
+MemcpyEngine::MemcpyEngine() {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    if (supportsAVX2) {
+        MemcpyEngine::copyWithStreamingStores = copyWithStreamingStoresAvx2;
+        MemcpyEngine::copyWithStreamingLoads = copyWithStreamingLoadsAvx2;
+    }
+}
+
+MemcpyEngine MemcpyEngine::initializer;
+
+} // namespace NEO
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "shared/source/helpers/memcpy_engine.h"
+
+#include <algorithm>
+#include <cstring>
+#include <immintrin.h>
+
+namespace NEO {
+
+constexpr size_t avx2VectorSize = sizeof(__m256i);
+
+static size_t getBytesToAlignment(const void *ptr, size_t size) {
+    auto misalignment = reinterpret_cast<uintptr_t>(ptr) & (avx2VectorSize - 1);
+    return std::min(misalignment ? avx2VectorSize - misalignment : 0, size);
+}
+
+// Non-temporal stores bypass the cache hierarchy and fill whole write-combining buffers,
+// which is the only fast way to write through a WC mapping of device memory.
+void copyWithStreamingStoresAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto head = getBytesToAlignment(dstBytes, size);
+    memcpy(dstBytes, srcBytes, head);
+    dstBytes += head;
+    srcBytes += head;
+    size -= head;
+
+    for (; size >= 4 * avx2VectorSize; size -= 4 * avx2VectorSize) {
+        auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + avx2VectorSize));
+        auto v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * avx2VectorSize));
+        auto v3 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * avx2VectorSize));
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + avx2VectorSize), v1);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * avx2VectorSize), v2);
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * avx2VectorSize), v3);
+        dstBytes += 4 * avx2VectorSize;
+        srcBytes += 4 * avx2VectorSize;
+    }
+    for (; size >= avx2VectorSize; size -= avx2VectorSize) {
+        _mm256_stream_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+        dstBytes += avx2VectorSize;
+        srcBytes += avx2VectorSize;
+    }
+    _mm_sfence();
+
+    memcpy(dstBytes, srcBytes, size);
+}
+
+// Streaming loads (MOVNTDQA) fetch full lines into streaming buffers instead of issuing
+// one uncached read per access when the source is an uncached or WC mapping.
+void copyWithStreamingLoadsAvx2(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto head = getBytesToAlignment(srcBytes, size);
+    memcpy(dstBytes, srcBytes, head);
+    dstBytes += head;
+    srcBytes += head;
+    size -= head;
+
+    _mm_mfence();
+    for (; size >= 4 * avx2VectorSize; size -= 4 * avx2VectorSize) {
+        auto v0 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes));
+        auto v1 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + avx2VectorSize));
+        auto v2 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + 2 * avx2VectorSize));
+        auto v3 = _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes + 3 * avx2VectorSize));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), v0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + avx2VectorSize), v1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 2 * avx2VectorSize), v2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes + 3 * avx2VectorSize), v3);
+        dstBytes += 4 * avx2VectorSize;
+        srcBytes += 4 * avx2VectorSize;
+    }
+    for (; size >= avx2VectorSize; size -= avx2VectorSize) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dstBytes), _mm256_stream_load_si256(reinterpret_cast<const __m256i *>(srcBytes)));
+        dstBytes += avx2VectorSize;
+        srcBytes += avx2VectorSize;
+    }
+
+    memcpy(dstBytes, srcBytes, size);
+}
+
+} // namespace NEO
+#endif
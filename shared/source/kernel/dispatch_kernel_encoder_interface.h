@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include <cstdint>
 
 namespace NEO {
+class DispatchTemplateCache;
 class GraphicsAllocation;
 struct ImplicitArgs;
 struct KernelDescriptor;
@@ -48,5 +49,7 @@ struct DispatchKernelEncoderI {
 
     virtual ImplicitArgs *getImplicitArgs() const = 0;
     virtual void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const = 0;
+
+    virtual DispatchTemplateCache *getDispatchTemplateCache() const = 0;
 };
 } // namespace NEO
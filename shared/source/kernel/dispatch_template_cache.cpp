@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/dispatch_template_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <cstring>
+
+namespace NEO {
+
+bool DispatchTemplateCache::Key::operator==(const Key &other) const {
+    return kernelStartPointer == other.kernelStartPointer &&
+           groupSize[0] == other.groupSize[0] &&
+           groupSize[1] == other.groupSize[1] &&
+           groupSize[2] == other.groupSize[2] &&
+           slmTotalSize == other.slmTotalSize &&
+           threadsPerThreadGroup == other.threadsPerThreadGroup &&
+           slmPolicy == other.slmPolicy &&
+           preemptionMode == other.preemptionMode;
+}
+
+DispatchTemplateCache::DispatchTemplateCache(size_t cacheSize) {
+    UNRECOVERABLE_IF(cacheSize == 0);
+    cache.resize(cacheSize);
+}
+
+std::unique_lock<std::mutex> DispatchTemplateCache::lock() {
+    return std::unique_lock<std::mutex>(templateCacheMutex);
+}
+
+bool DispatchTemplateCache::restoreTemplate(const Key &key, void *destination, size_t templateSize) {
+    auto templateCacheLock = lock();
+    for (auto &cacheEntry : cache) {
+        if (cacheEntry.valid && cacheEntry.size == templateSize && cacheEntry.key == key) {
+            cacheEntry.lastUse = ++useStamp;
+            std::memcpy(destination, cacheEntry.data.data(), templateSize);
+            hitCount++;
+            return true;
+        }
+    }
+    missCount++;
+    return false;
+}
+
+void DispatchTemplateCache::storeTemplate(const Key &key, const void *source, size_t templateSize) {
+    UNRECOVERABLE_IF(templateSize > maxTemplateSize);
+
+    auto templateCacheLock = lock();
+    DispatchTemplateCacheEntry *leastRecentlyUsedEntry = &cache[0];
+    for (auto &cacheEntry : cache) {
+        if (!cacheEntry.valid) {
+            leastRecentlyUsedEntry = &cacheEntry;
+            break;
+        }
+        if (cacheEntry.lastUse < leastRecentlyUsedEntry->lastUse) {
+            leastRecentlyUsedEntry = &cacheEntry;
+        }
+    }
+
+    leastRecentlyUsedEntry->key = key;
+    leastRecentlyUsedEntry->size = templateSize;
+    leastRecentlyUsedEntry->lastUse = ++useStamp;
+    leastRecentlyUsedEntry->valid = true;
+    std::memcpy(leastRecentlyUsedEntry->data.data(), source, templateSize);
+}
+
+} // namespace NEO
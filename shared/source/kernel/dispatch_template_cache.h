@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace NEO {
+
+// Owned by a single kernel, which may be appended from several threads at once, so accesses are serialized.
+// When full, the least recently used entry is replaced.
+class DispatchTemplateCache {
+  public:
+    static constexpr size_t maxTemplateSize = 64u;
+
+    struct Key {
+        uint64_t kernelStartPointer = 0u;
+        uint32_t groupSize[3] = {0u, 0u, 0u};
+        uint32_t slmTotalSize = 0u;
+        uint32_t threadsPerThreadGroup = 0u;
+        SlmPolicy slmPolicy = SlmPolicy::slmPolicyNone;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+
+        bool operator==(const Key &other) const;
+    };
+
+    struct DispatchTemplateCacheEntry {
+        Key key{};
+        std::array<uint8_t, maxTemplateSize> data{};
+        size_t size = 0u;
+        uint64_t lastUse = 0u;
+        bool valid = false;
+    };
+
+    DispatchTemplateCache() = delete;
+    DispatchTemplateCache(DispatchTemplateCache &) = delete;
+    DispatchTemplateCache &operator=(const DispatchTemplateCache &other) = delete;
+
+    DispatchTemplateCache(size_t cacheSize);
+
+    bool restoreTemplate(const Key &key, void *destination, size_t templateSize);
+    void storeTemplate(const Key &key, const void *source, size_t templateSize);
+
+    uint64_t getHitCount() const { return hitCount; }
+    uint64_t getMissCount() const { return missCount; }
+
+  protected:
+    std::unique_lock<std::mutex> lock();
+
+    StackVec<DispatchTemplateCacheEntry, 4> cache;
+    std::mutex templateCacheMutex;
+    uint64_t useStamp = 0u;
+    uint64_t hitCount = 0u;
+    uint64_t missCount = 0u;
+};
+} // namespace NEO
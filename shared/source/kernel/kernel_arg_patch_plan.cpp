@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/kernel_arg_patch_plan.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+void KernelArgPatchPlan::build(const KernelDescriptor &kernelDescriptor) {
+    const auto &explicitArgs = kernelDescriptor.payloadMappings.explicitArgs;
+    args.clear();
+    valuePatches.clear();
+    args.resize(explicitArgs.size());
+
+    for (uint32_t argIndex = 0; argIndex < explicitArgs.size(); argIndex++) {
+        const auto &arg = explicitArgs[argIndex];
+        if (false == arg.is<ArgDescriptor::argTValue>()) {
+            continue;
+        }
+        auto &argPlan = args[argIndex];
+        argPlan.firstPatch = static_cast<uint32_t>(valuePatches.size());
+        for (const auto &element : arg.as<ArgDescValue>().elements) {
+            if (isUndefinedOffset(element.offset) || element.size == 0) {
+                continue;
+            }
+            valuePatches.push_back({element.offset, element.size, element.sourceOffset});
+            argPlan.maxSourceOffset = std::max(argPlan.maxSourceOffset, static_cast<uint32_t>(element.sourceOffset));
+        }
+        argPlan.patchesCount = static_cast<uint32_t>(valuePatches.size()) - argPlan.firstPatch;
+    }
+}
+
+void KernelArgPatchPlan::patchValue(uint32_t argIndex, ArrayRef<uint8_t> crossThreadData, size_t argSize, const void *argVal) const {
+    const auto &argPlan = args[argIndex];
+    const auto patchesEnd = argPlan.firstPatch + argPlan.patchesCount;
+    for (auto patchIndex = argPlan.firstPatch; patchIndex < patchesEnd; patchIndex++) {
+        const auto &patch = valuePatches[patchIndex];
+        if (patch.sourceOffset >= argSize) {
+            continue;
+        }
+        DEBUG_BREAK_IF(static_cast<size_t>(patch.offset) + patch.size > crossThreadData.size());
+        const auto bytesToCopy = std::min(static_cast<size_t>(patch.size), argSize - patch.sourceOffset);
+        auto pDst = ptrOffset(crossThreadData.begin(), patch.offset);
+        if (argVal) {
+            memcpy_s(pDst, patch.size, ptrOffset(argVal, patch.sourceOffset), bytesToCopy);
+        } else {
+            memset(pDst, 0, bytesToCopy);
+        }
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/kernel/kernel_arg_descriptor.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+struct KernelDescriptor;
+
+// Flat per-kernel table of cross thread data patches for by-value arguments, built once at kernel creation
+// so setting an argument does not walk ArgDescriptor variants and element containers on every call.
+class KernelArgPatchPlan {
+  public:
+    struct ValuePatch {
+        CrossThreadDataOffset offset = 0;
+        uint16_t size = 0;
+        uint16_t sourceOffset = 0;
+    };
+
+    struct ArgPlan {
+        uint32_t firstPatch = 0;
+        uint32_t patchesCount = 0;
+        uint32_t maxSourceOffset = 0;
+    };
+
+    void build(const KernelDescriptor &kernelDescriptor);
+
+    size_t getArgsCount() const { return args.size(); }
+    size_t getValuePatchesCount() const { return valuePatches.size(); }
+    const ArgPlan &getArgPlan(uint32_t argIndex) const { return args[argIndex]; }
+
+    bool isArgSizeSufficient(uint32_t argIndex, size_t argSize) const {
+        const auto &argPlan = args[argIndex];
+        return argPlan.patchesCount == 0 || argSize > argPlan.maxSourceOffset;
+    }
+
+    // Elements starting beyond argSize are skipped, nullptr argVal zeroes the patched bytes.
+    void patchValue(uint32_t argIndex, ArrayRef<uint8_t> crossThreadData, size_t argSize, const void *argVal) const;
+
+  protected:
+    std::vector<ArgPlan> args;
+    std::vector<ValuePatch> valuePatches;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/simd_helper.h"
+#include "shared/source/kernel/shared_local_ids_cache.h"
 
 #include <cstring>
 
@@ -53,6 +54,11 @@ void LocalIdsCache::setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destina
 }
 
 void LocalIdsCache::setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const GfxCoreHelper &gfxCoreHelper) {
+    if (sharedCache) {
+        SharedLocalIdsCache::Key key{group, wgDimOrder, simdSize, grfSize, usesOnlyImages};
+        return sharedCache->emitLocalIds(key, destination, getLocalIdsSizeForGroup(group, gfxCoreHelper), gfxCoreHelper);
+    }
+
     auto setLocalIdsLock = lock();
     LocalIdsCacheEntry *leastAccessedEntry = &cache[0];
     for (auto &cacheEntry : cache) {
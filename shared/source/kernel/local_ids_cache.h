@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,8 @@
 
 namespace NEO {
 class GfxCoreHelper;
+class SharedLocalIdsCache;
+
 class LocalIdsCache {
   public:
     struct LocalIdsCacheEntry {
@@ -33,6 +35,7 @@ class LocalIdsCache {
     void setLocalIdsForGroup(const Vec3<uint16_t> &group, void *destination, const GfxCoreHelper &gfxCoreHelper);
     size_t getLocalIdsSizeForGroup(const Vec3<uint16_t> &group, const GfxCoreHelper &gfxCoreHelper) const;
     size_t getLocalIdsSizePerThread() const;
+    void setSharedCache(SharedLocalIdsCache *cache) { sharedCache = cache; }
 
   protected:
     void setLocalIdsForEntry(LocalIdsCacheEntry &entry, void *destination);
@@ -41,6 +44,7 @@ class LocalIdsCache {
 
     StackVec<LocalIdsCacheEntry, 4> cache;
     std::mutex setLocalIdsMutex;
+    SharedLocalIdsCache *sharedCache = nullptr;
     const std::array<uint8_t, 3> wgDimOrder;
     const uint32_t localIdsSizePerThread;
     const uint8_t grfSize;
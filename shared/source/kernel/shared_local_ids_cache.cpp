@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/shared_local_ids_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+SharedLocalIdsCache::Entry::~Entry() {
+    alignedFree(data);
+}
+
+SharedLocalIdsCache::SharedLocalIdsCache(size_t budget) : budget(budget) {}
+
+SharedLocalIdsCache::~SharedLocalIdsCache() {
+    for (auto &slot : slots) {
+        evict(slot);
+    }
+}
+
+size_t SharedLocalIdsCache::getBudgetFromDebugFlags() {
+    if (debugManager.flags.SharedLocalIdsCacheBudgetKB.get() > 0) {
+        return static_cast<size_t>(debugManager.flags.SharedLocalIdsCacheBudgetKB.get()) * MemoryConstants::kiloByte;
+    }
+    return defaultBudget;
+}
+
+uint64_t SharedLocalIdsCache::packKey(const Key &key) {
+    constexpr uint16_t maxGroupSize = (1u << 12) - 1;
+    if (key.groupSize[0] > maxGroupSize || key.groupSize[1] > maxGroupSize || key.groupSize[2] > maxGroupSize ||
+        key.simdSize == 0 || key.simdSize > 32 || key.grfSize > 127) {
+        return 0u;
+    }
+    uint64_t packedKey = key.groupSize[0];
+    packedKey = (packedKey << 12) | key.groupSize[1];
+    packedKey = (packedKey << 12) | key.groupSize[2];
+    packedKey = (packedKey << 6) | key.simdSize;
+    packedKey = (packedKey << 7) | key.grfSize;
+    packedKey = (packedKey << 2) | (key.wgDimOrder[0] & 0x3);
+    packedKey = (packedKey << 2) | (key.wgDimOrder[1] & 0x3);
+    packedKey = (packedKey << 2) | (key.wgDimOrder[2] & 0x3);
+    packedKey = (packedKey << 1) | (key.usesOnlyImages ? 1u : 0u);
+    return packedKey;
+}
+
+uint32_t SharedLocalIdsCache::getFirstSlotIndex(uint64_t packedKey) {
+    auto hash = packedKey * 0x9e3779b97f4a7c15ull;
+    return static_cast<uint32_t>(hash >> 32) % slotsCount;
+}
+
+void SharedLocalIdsCache::emitLocalIds(const Key &key, void *destination, size_t size, const GfxCoreHelper &gfxCoreHelper) {
+    const auto packedKey = packKey(key);
+    if (packedKey != 0u && tryEmitFromCache(packedKey, destination, size)) {
+        hitCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    missCount.fetch_add(1, std::memory_order_relaxed);
+
+    // generators use aligned vector stores, so data is generated into the entry and copied to the destination once
+    auto entry = std::make_unique<Entry>();
+    entry->packedKey = packedKey;
+    entry->size = size;
+    entry->data = static_cast<uint8_t *>(alignedMalloc(size, 32));
+    generateLocalIDs(entry->data, static_cast<uint16_t>(key.simdSize),
+                     {key.groupSize[0], key.groupSize[1], key.groupSize[2]}, key.wgDimOrder, key.usesOnlyImages, key.grfSize, gfxCoreHelper);
+    std::memcpy(destination, entry->data, size);
+
+    if (packedKey != 0u && size <= budget) {
+        insert(std::move(entry));
+    }
+}
+
+bool SharedLocalIdsCache::tryEmitFromCache(uint64_t packedKey, void *destination, size_t size) {
+    const auto firstSlotIndex = getFirstSlotIndex(packedKey);
+    for (uint32_t probe = 0; probe < probeLength; probe++) {
+        auto &slot = slots[(firstSlotIndex + probe) % slotsCount];
+        slot.readers.fetch_add(1);
+        auto entry = slot.entry.load();
+        const bool hit = entry != nullptr && entry->packedKey == packedKey;
+        if (hit) {
+            DEBUG_BREAK_IF(entry->size != size);
+            std::memcpy(destination, entry->data, std::min(entry->size, size));
+            entry->lastUse.store(useCounter.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        slot.readers.fetch_sub(1);
+        if (hit) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedLocalIdsCache::insert(std::unique_ptr<Entry> newEntry) {
+    const auto packedKey = newEntry->packedKey;
+    const auto size = newEntry->size;
+    std::lock_guard<std::mutex> lock(insertMtx);
+
+    const auto firstSlotIndex = getFirstSlotIndex(packedKey);
+    Slot *victim = nullptr;
+    uint64_t victimLastUse = 0;
+    for (uint32_t probe = 0; probe < probeLength; probe++) {
+        auto &slot = slots[(firstSlotIndex + probe) % slotsCount];
+        auto entry = slot.entry.load();
+        if (entry != nullptr && entry->packedKey == packedKey) {
+            return;
+        }
+        // empty slots are preferred over evicting the least recently used entry
+        auto lastUse = entry ? entry->lastUse.load(std::memory_order_relaxed) + 1 : 0u;
+        if (victim == nullptr || lastUse < victimLastUse) {
+            victim = &slot;
+            victimLastUse = lastUse;
+        }
+    }
+    evict(*victim);
+
+    while (getCachedBytes() + size > budget) {
+        Slot *leastRecentlyUsed = nullptr;
+        uint64_t leastRecentlyUsedLastUse = 0;
+        for (auto &slot : slots) {
+            auto entry = slot.entry.load();
+            if (entry == nullptr) {
+                continue;
+            }
+            auto lastUse = entry->lastUse.load(std::memory_order_relaxed);
+            if (leastRecentlyUsed == nullptr || lastUse < leastRecentlyUsedLastUse) {
+                leastRecentlyUsed = &slot;
+                leastRecentlyUsedLastUse = lastUse;
+            }
+        }
+        if (leastRecentlyUsed == nullptr) {
+            break;
+        }
+        evict(*leastRecentlyUsed);
+    }
+
+    newEntry->lastUse.store(useCounter.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+    cachedBytes.fetch_add(size, std::memory_order_relaxed);
+    victim->entry.store(newEntry.release());
+}
+
+void SharedLocalIdsCache::evict(Slot &slot) {
+    auto entry = slot.entry.exchange(nullptr);
+    if (entry == nullptr) {
+        return;
+    }
+    while (slot.readers.load() != 0) {
+        CpuIntrinsics::pause();
+    }
+    cachedBytes.fetch_sub(entry->size, std::memory_order_relaxed);
+    delete entry;
+}
+
+} // namespace NEO
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/vec.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class GfxCoreHelper;
+
+// Device-wide cache of runtime generated local IDs, keyed by the layout of the generated data so kernels with
+// identical layouts share one blob. Lookups are lock-free, inserts are serialized and replace a slot only after
+// readers that may still see the previous entry have left it.
+class SharedLocalIdsCache {
+  public:
+    static constexpr uint32_t slotsCount = 64;
+    static constexpr uint32_t probeLength = 4;
+    static constexpr size_t defaultBudget = 4 * MemoryConstants::megaByte;
+
+    struct Key {
+        Vec3<uint16_t> groupSize = {0, 0, 0};
+        std::array<uint8_t, 3> wgDimOrder = {0, 1, 2};
+        uint8_t simdSize = 0;
+        uint8_t grfSize = 0;
+        bool usesOnlyImages = false;
+    };
+
+    SharedLocalIdsCache(size_t budget);
+    ~SharedLocalIdsCache();
+
+    SharedLocalIdsCache(const SharedLocalIdsCache &) = delete;
+    SharedLocalIdsCache &operator=(const SharedLocalIdsCache &) = delete;
+
+    static size_t getBudgetFromDebugFlags();
+    static uint64_t packKey(const Key &key);
+
+    // Writes size bytes of local IDs to destination. Cached blobs are copied straight to the destination (e.g. indirect heap).
+    void emitLocalIds(const Key &key, void *destination, size_t size, const GfxCoreHelper &gfxCoreHelper);
+
+    size_t getCachedBytes() const { return cachedBytes.load(std::memory_order_relaxed); }
+    uint64_t getHitCount() const { return hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return missCount.load(std::memory_order_relaxed); }
+
+  protected:
+    struct Entry {
+        ~Entry();
+
+        uint64_t packedKey = 0;
+        size_t size = 0;
+        uint8_t *data = nullptr;
+        std::atomic<uint64_t> lastUse{0};
+    };
+
+    struct Slot {
+        std::atomic<Entry *> entry{nullptr};
+        std::atomic<uint32_t> readers{0};
+    };
+
+    static uint32_t getFirstSlotIndex(uint64_t packedKey);
+    bool tryEmitFromCache(uint64_t packedKey, void *destination, size_t size);
+    void insert(std::unique_ptr<Entry> newEntry);
+    void evict(Slot &slot);
+
+    std::array<Slot, slotsCount> slots;
+    std::mutex insertMtx;
+    std::atomic<size_t> cachedBytes{0};
+    std::atomic<uint64_t> useCounter{0};
+    std::atomic<uint64_t> hitCount{0};
+    std::atomic<uint64_t> missCount{0};
+    const size_t budget;
+};
+
+} // namespace NEO
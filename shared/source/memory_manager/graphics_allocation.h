@@ -53,6 +53,28 @@ struct SurfaceStateInHeapInfo {
     size_t ssSize;
 };
 
+struct BindlessSurfaceStateKey {
+    uint64_t gpuAddress = 0;
+    uint64_t size = 0;
+    uint32_t mocs = 0;
+    uint32_t numAvailableDevices = 0;
+    bool useGlobalAtomics = false;
+    bool implicitScaling = false;
+    bool isDebuggerActive = false;
+    bool valid = false;
+
+    bool operator==(const BindlessSurfaceStateKey &other) const {
+        return gpuAddress == other.gpuAddress &&
+               size == other.size &&
+               mocs == other.mocs &&
+               numAvailableDevices == other.numAvailableDevices &&
+               useGlobalAtomics == other.useGlobalAtomics &&
+               implicitScaling == other.implicitScaling &&
+               isDebuggerActive == other.isDebuggerActive &&
+               valid == other.valid;
+    }
+};
+
 class GraphicsAllocation : public IDNode<GraphicsAllocation> {
   public:
     enum UsmInitialPlacement {
@@ -307,6 +329,15 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     void setBindlessInfo(const SurfaceStateInHeapInfo &info) {
         bindlessInfo = info;
+        bindlessSurfaceStateKey = {};
+    }
+
+    const BindlessSurfaceStateKey &getBindlessSurfaceStateKey() const {
+        return bindlessSurfaceStateKey;
+    }
+
+    void setBindlessSurfaceStateKey(const BindlessSurfaceStateKey &key) {
+        bindlessSurfaceStateKey = key;
     }
 
     SurfaceStateInHeapInfo getBindlessInfo() {
@@ -370,6 +401,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     SharingInfo sharingInfo;
     ReservedAddressRange reservedAddressRangeInfo;
     SurfaceStateInHeapInfo bindlessInfo = {nullptr, 0, nullptr};
+    BindlessSurfaceStateKey bindlessSurfaceStateKey = {};
 
     uint64_t allocationOffset = 0u;
     uint64_t gpuBaseAddress = 0;
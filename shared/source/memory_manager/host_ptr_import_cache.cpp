@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/host_ptr_import_cache.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace NEO {
+
+HostPtrImportCache::HostPtrImportCache(MemoryManager &memoryManager, size_t budget) : memoryManager(memoryManager), budget(budget) {}
+
+HostPtrImportCache::~HostPtrImportCache() {
+    clear();
+}
+
+bool HostPtrImportCache::overlaps(const Entry &entry, const void *ptr, size_t size) {
+    auto entryBegin = entry.allocation->getUnderlyingBuffer();
+    auto entryEnd = ptrOffset(entryBegin, entry.allocation->getUnderlyingBufferSize());
+    return entryBegin < ptrOffset(ptr, size) && ptr < entryEnd;
+}
+
+bool HostPtrImportCache::isIdle(Entry &entry) {
+    // an acquirer is done once a submission after its acquire assigned the allocation a later task count
+    auto allocation = entry.allocation;
+    auto firstPending = std::remove_if(entry.acquirers.begin(), entry.acquirers.end(), [allocation](const Acquirer &acquirer) {
+        auto allocationTaskCount = allocation->getTaskCount(acquirer.csr->getOsContext().getContextId());
+        return allocationTaskCount != GraphicsAllocation::objectNotUsed && allocationTaskCount > acquirer.taskCount;
+    });
+    entry.acquirers.resize(static_cast<size_t>(std::distance(entry.acquirers.begin(), firstPending)));
+    return entry.acquirers.empty();
+}
+
+void HostPtrImportCache::markPending(Entry &entry, CommandStreamReceiver &csr) {
+    // residency consumes one assignment per submission, so repeated acquires before the same submission count once
+    isIdle(entry);
+    for (auto &acquirer : entry.acquirers) {
+        if (acquirer.csr == &csr) {
+            if (acquirer.taskCount != csr.peekTaskCount()) {
+                acquirer.taskCount = csr.peekTaskCount();
+                entry.allocation->hostPtrTaskCountAssignment++;
+            }
+            return;
+        }
+    }
+    entry.acquirers.push_back({&csr, csr.peekTaskCount()});
+    entry.allocation->hostPtrTaskCountAssignment++;
+}
+
+GraphicsAllocation *HostPtrImportCache::acquire(const void *ptr, size_t size, CommandStreamReceiver &csr) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto entry = entries.upper_bound(ptr);
+    if (entry != entries.begin()) {
+        auto candidate = std::prev(entry);
+        auto allocation = candidate->second.allocation;
+        if (ptrOffset(allocation->getUnderlyingBuffer(), allocation->getUnderlyingBufferSize()) >= ptrOffset(ptr, size)) {
+            lruList.splice(lruList.begin(), lruList, candidate->second.lruPosition);
+            markPending(candidate->second, csr);
+            return allocation;
+        }
+        if (overlaps(candidate->second, ptr, size) && isIdle(candidate->second)) {
+            erase(candidate);
+        }
+    }
+    while (entry != entries.end() && entry->first < ptrOffset(ptr, size)) {
+        entry = isIdle(entry->second) ? erase(entry) : std::next(entry);
+    }
+    return nullptr;
+}
+
+bool HostPtrImportCache::insert(GraphicsAllocation *allocation, CommandStreamReceiver &csr) {
+    const auto size = allocation->getUnderlyingBufferSize();
+    if (size > budget) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entries.find(allocation->getUnderlyingBuffer()) != entries.end()) {
+        return false;
+    }
+    evictToFit(size);
+    if (cachedBytes + size > budget) {
+        return false;
+    }
+
+    lruList.push_front(allocation->getUnderlyingBuffer());
+    auto entry = entries.emplace(allocation->getUnderlyingBuffer(), Entry{allocation, lruList.begin(), {}}).first;
+    markPending(entry->second, csr);
+    cachedBytes += size;
+    return true;
+}
+
+void HostPtrImportCache::evictToFit(size_t size) {
+    auto lruPosition = lruList.end();
+    while (cachedBytes + size > budget && lruPosition != lruList.begin()) {
+        lruPosition--;
+        auto entry = entries.find(*lruPosition);
+        if (!isIdle(entry->second)) {
+            continue;
+        }
+        lruPosition = std::next(lruPosition);
+        erase(entry);
+    }
+}
+
+void HostPtrImportCache::invalidateRange(const void *ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.upper_bound(ptr);
+    if (entry != entries.begin() && overlaps(std::prev(entry)->second, ptr, size)) {
+        entry = std::prev(entry);
+    }
+    while (entry != entries.end() && entry->first < ptrOffset(ptr, size)) {
+        entry = erase(entry);
+    }
+}
+
+void HostPtrImportCache::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.begin();
+    while (entry != entries.end()) {
+        entry = erase(entry);
+    }
+}
+
+HostPtrImportCache::EntriesContainer::iterator HostPtrImportCache::erase(EntriesContainer::iterator entry) {
+    auto allocation = entry->second.allocation;
+    cachedBytes -= allocation->getUnderlyingBufferSize();
+    lruList.erase(entry->second.lruPosition);
+    // acquires of one csr folded into a single submission leave assignments nobody consumes
+    if (isIdle(entry->second)) {
+        allocation->hostPtrTaskCountAssignment = 0;
+    }
+    memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    return entries.erase(entry);
+}
+
+size_t HostPtrImportCache::getCachedBytes() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedBytes;
+}
+
+size_t HostPtrImportCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+} // namespace NEO
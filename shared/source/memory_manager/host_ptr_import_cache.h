@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace NEO {
+class CommandStreamReceiver;
+class GraphicsAllocation;
+class MemoryManager;
+
+// Keeps external host pointer allocations (userptr imports of non-USM host memory) alive after their
+// transfers complete, so repeated copies from the same host range do not pin and unpin it every time.
+// Entries are evicted in LRU order once the pinned bytes exceed the budget. Each command stream receiver
+// acquiring an entry adds its own task count assignment, so acquires from several of them all keep the
+// allocation pending. The cache remembers each acquirer's task count at acquire time; an entry is idle only
+// once every acquirer has submitted past it. Pages backing an import are
+// tracked by the kernel through userptr invalidation (i915 MMU notifiers), so a range that gets unmapped
+// and mapped again is revalidated on the next submission; the cache must only be used on driver models
+// providing that guarantee. Ranges the driver knows to be changing are dropped with invalidateRange.
+class HostPtrImportCache {
+  public:
+    static constexpr size_t defaultBudget = 256 * MemoryConstants::megaByte;
+
+    HostPtrImportCache(MemoryManager &memoryManager, size_t budget);
+    ~HostPtrImportCache();
+
+    HostPtrImportCache(const HostPtrImportCache &) = delete;
+    HostPtrImportCache &operator=(const HostPtrImportCache &) = delete;
+
+    // Returns a cached allocation containing the whole range, marked as pending task count assignment on csr.
+    // On miss, idle entries partially overlapping the range are dropped so a new import does not collide with them.
+    GraphicsAllocation *acquire(const void *ptr, size_t size, CommandStreamReceiver &csr);
+    // Takes ownership of the allocation and marks it as acquired by csr. Returns false if it cannot be cached.
+    bool insert(GraphicsAllocation *allocation, CommandStreamReceiver &csr);
+    void invalidateRange(const void *ptr, size_t size);
+    void clear();
+
+    size_t getCachedBytes() const;
+    size_t getEntriesCount() const;
+    size_t getBudget() const { return budget; }
+
+  protected:
+    struct Acquirer {
+        CommandStreamReceiver *csr = nullptr;
+        TaskCountType taskCount = 0;
+    };
+
+    struct Entry {
+        GraphicsAllocation *allocation = nullptr;
+        std::list<const void *>::iterator lruPosition;
+        StackVec<Acquirer, 2> acquirers;
+    };
+    using EntriesContainer = std::map<const void *, Entry>;
+
+    static bool overlaps(const Entry &entry, const void *ptr, size_t size);
+    static bool isIdle(Entry &entry);
+    static void markPending(Entry &entry, CommandStreamReceiver &csr);
+    EntriesContainer::iterator erase(EntriesContainer::iterator entry);
+    void evictToFit(size_t size);
+
+    MemoryManager &memoryManager;
+    const size_t budget;
+    size_t cachedBytes = 0;
+
+    EntriesContainer entries;
+    std::list<const void *> lruList;
+    mutable std::mutex mtx;
+};
+
+} // namespace NEO
@@ -26,6 +26,7 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/submission_tracer.h"
 
 namespace NEO {
 
@@ -260,6 +261,7 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
 
 template <typename GfxFamily>
 SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    SubmissionTraceScope traceScope(SubmissionStage::residency);
     if (drm->isVmBindAvailable()) {
         return SubmissionStatus::success;
     }
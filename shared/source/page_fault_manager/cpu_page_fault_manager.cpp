@@ -8,6 +8,7 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
@@ -94,18 +95,81 @@ inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::gpu;
 }
 
+PageFaultManager::MemoryDataContainer::iterator PageFaultManager::findAllocationContainingPtr(void *ptr) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return this->memoryData.end();
+    }
+    --alloc;
+    if (ptr < ptrOffset(alloc->first, alloc->second.size)) {
+        return alloc;
+    }
+    return this->memoryData.end();
+}
+
 bool PageFaultManager::verifyPageFault(void *ptr) {
     std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
+    auto alloc = findAllocationContainingPtr(ptr);
+    if (alloc == this->memoryData.end()) {
+        return false;
+    }
+
+    auto allocPtr = alloc->first;
+    auto &pageFaultData = alloc->second;
+    auto neighbourhoodSize = debugManager.flags.PageFaultManagerMigrationNeighbourhood.get();
+    if (neighbourhoodSize > 0 && gpuDomainHandler == &transferAndUnprotectMemory && pageFaultData.domain == AllocationDomain::gpu) {
+        transferAndUnprotectNeighbourhood(alloc, static_cast<uint32_t>(neighbourhoodSize));
+        return true;
+    }
+
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+    gpuDomainHandler(this, allocPtr, pageFaultData);
+    return true;
+}
+
+void PageFaultManager::transferAndUnprotectNeighbourhood(MemoryDataContainer::iterator faultedAlloc, uint32_t neighbourhoodSize) {
+    auto &faultedData = faultedAlloc->second;
+    auto isMigratedTogether = [&faultedData](const PageFaultData &pageFaultData) {
+        return pageFaultData.domain == AllocationDomain::gpu &&
+               pageFaultData.cmdQ == faultedData.cmdQ &&
+               pageFaultData.unifiedMemoryManager == faultedData.unifiedMemoryManager;
+    };
+
+    auto first = faultedAlloc;
+    for (uint32_t i = 0; i < neighbourhoodSize && first != this->memoryData.begin(); i++) {
+        if (!isMigratedTogether(std::prev(first)->second)) {
+            break;
         }
+        --first;
+    }
+    auto last = std::next(faultedAlloc);
+    for (uint32_t i = 0; i < neighbourhoodSize && last != this->memoryData.end(); i++) {
+        if (!isMigratedTogether(last->second)) {
+            break;
+        }
+        ++last;
+    }
+
+    for (auto alloc = first; alloc != last; ++alloc) {
+        this->setAubWritable(true, alloc->first, alloc->second.unifiedMemoryManager);
+        this->migrateStorageToCpuDomain(alloc->first, alloc->second);
+    }
+
+    void *rangeStart = first->first;
+    void *rangeEnd = first->first;
+    for (auto alloc = first; alloc != last; ++alloc) {
+        if (alloc->first != rangeEnd) {
+            this->allowCPUMemoryAccess(rangeStart, ptrDiff(rangeEnd, rangeStart));
+            rangeStart = alloc->first;
+        }
+        rangeEnd = alignUp(ptrOffset(alloc->first, alloc->second.size), MemoryConstants::pageSize);
+    }
+    this->allowCPUMemoryAccess(rangeStart, ptrDiff(rangeEnd, rangeStart));
+
+    for (auto alloc = first; alloc != last; ++alloc) {
+        this->setCpuAllocEvictable(true, alloc->first, alloc->second.unifiedMemoryManager);
+        this->allowCPUMemoryEviction(alloc->first, alloc->second);
     }
-    return false;
 }
 
 void PageFaultManager::setGpuDomainHandler(gpuDomainHandlerFunc gpuHandlerFuncPtr) {
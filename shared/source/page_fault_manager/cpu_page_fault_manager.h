@@ -10,8 +10,9 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 namespace NEO {
 struct MemoryProperties;
@@ -71,9 +72,13 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
 
+    using MemoryDataContainer = std::map<void *, PageFaultData>;
+    MemoryDataContainer::iterator findAllocationContainingPtr(void *ptr);
+    void transferAndUnprotectNeighbourhood(MemoryDataContainer::iterator faultedAlloc, uint32_t neighbourhoodSize);
+
     decltype(&transferAndUnprotectMemory) gpuDomainHandler = &transferAndUnprotectMemory;
 
-    std::unordered_map<void *, PageFaultData> memoryData;
+    MemoryDataContainer memoryData;
     SpinLock mtx;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,25 +7,45 @@
 
 #include "print_formatter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/string.h"
 
+#include <cstring>
 #include <iostream>
 
 namespace NEO {
 
+const CompiledPrintfFormat &PrintfFormatCache::get(const char *formatString) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &compiledFormat = compiledFormats[formatString];
+    if (compiledFormat == nullptr) {
+        compiledFormat = PrintFormatter::compileFormatString(formatString);
+    }
+    return *compiledFormat;
+}
+
+size_t PrintfFormatCache::getCompiledFormatsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return compiledFormats.size();
+}
+
 PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                               bool using32BitPointers, const StringMap *stringLiteralMap)
+                               bool using32BitPointers, const StringMap *stringLiteralMap, PrintfFormatCache *formatCache)
     : printfOutputBuffer(printfOutputBuffer),
       printfOutputBufferSize(printfOutputBufferMaxSize),
       using32BitPointers(using32BitPointers),
       usesStringMap(stringLiteralMap != nullptr),
-      stringLiteralMap(stringLiteralMap) {
+      stringLiteralMap(stringLiteralMap),
+      formatCache(formatCache != nullptr ? formatCache : &ownFormatCache) {
 
-    output.reset(new char[maxSinglePrintStringLength]);
+    streamingOutput = debugManager.flags.EnableStreamingPrintfFormatter.get() == 1;
+    outputSize = streamingOutput ? streamingOutputBufferSize : maxSinglePrintStringLength;
+    output.reset(new char[outputSize]);
 }
 
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
     currentOffset = initialOffset;
+    outputUsed = 0;
 
     // first 4 bytes of the buffer store the actual size of data that was written by printf from within EUs
     uint32_t printfOutputBufferSizeRead = 0;
@@ -53,43 +73,138 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
             }
         }
     }
+
+    if (streamingOutput && outputUsed > 0) {
+        flushOutput(print);
+    }
+}
+
+const CompiledPrintfFormat &PrintFormatter::getCompiledFormat(const char *formatString) {
+    if (formatString != lastFormatString) {
+        lastCompiledFormat = &formatCache->get(formatString);
+        lastFormatString = formatString;
+    }
+    return *lastCompiledFormat;
 }
 
 void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+    const auto &compiledFormat = getCompiledFormat(formatString);
 
-    size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
+    statementEnd = outputUsed + maxSinglePrintStringLength - 1;
+    statementTerminated = false;
 
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+    for (const auto &token : compiledFormat) {
+        appendLiteral(token.literal);
+        if (token.hasConversion && !statementTerminated) {
+            auto cursor = output.get() + outputUsed;
+            auto size = statementEnd - outputUsed + 1;
+            commitPrinted(token.isString ? printStringToken(cursor, size, token) : printToken(cursor, size, token));
+        }
+        if (statementTerminated) {
+            break;
+        }
+    }
+
+    // without streaming every printf call is printed separately, otherwise output is flushed once the buffer
+    // cannot fit another call
+    if (!streamingOutput || outputSize - outputUsed < maxSinglePrintStringLength) {
+        flushOutput(print);
+    }
+}
+
+void PrintFormatter::appendLiteral(const std::string &literal) {
+    auto length = std::min(literal.size(), statementEnd - outputUsed);
+    memcpy_s(output.get() + outputUsed, outputSize - outputUsed, literal.c_str(), length);
+    outputUsed += length;
+    statementTerminated |= length < literal.size();
+}
+
+void PrintFormatter::commitPrinted(size_t printed) {
+    auto written = std::min(printed, statementEnd - outputUsed);
+    // printed values may contain a null character, which ends the printf call output
+    auto terminator = memchr(output.get() + outputUsed, '\0', written);
+    if (terminator != nullptr) {
+        written = static_cast<char *>(terminator) - (output.get() + outputUsed);
+        statementTerminated = true;
+    }
+    statementTerminated |= written < printed;
+    outputUsed += written;
+}
+
+void PrintFormatter::flushOutput(const std::function<void(char *)> &print) {
+    output[outputUsed] = '\0';
+    print(output.get());
+    outputUsed = 0;
+}
+
+template <>
+void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
+    auto longPosition = formatString.find('l');
+
+    if (longPosition == std::string::npos) {
+        return;
+    }
+    UNRECOVERABLE_IF(formatString.size() - 1 == longPosition);
+
+    if (formatString.at(longPosition + 1) != 'l') {
+        formatString.insert(longPosition, "l");
+    }
+}
+
+std::unique_ptr<CompiledPrintfFormat> PrintFormatter::compileFormatString(const char *formatString) {
+    auto compiledFormat = std::make_unique<CompiledPrintfFormat>();
+    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+
+    PrintfFormatToken token;
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            if (++i == length) {
+                break;
+            }
+            token.literal += escapeChar(formatString[i]);
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                token.literal += '%';
                 i++;
                 continue;
             }
 
+            size_t end = i;
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
+            token.format.assign(formatString + i, end - i);
+            token.hasConversion = true;
+            token.isString = formatString[end - 1] == 's';
+
+            if (token.format.back() != 'l') {
+                token.longFormat = token.format;
+                adjustFormatString<int64_t>(token.longFormat);
+            }
 
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
+            // padded, stripVectorFormat may skip over the terminating null
+            std::string stripped(token.format.size() + 3, '\0');
+            std::string padded(stripped);
+            padded.replace(0, token.format.size(), token.format);
+            stripVectorFormat(padded.c_str(), &stripped[0]);
+            stripVectorTypeConversion(&stripped[0]);
+            token.vectorFormat = stripped.c_str();
+            if (!token.vectorFormat.empty() && token.vectorFormat.back() != 'l') {
+                token.vectorLongFormat = token.vectorFormat;
+                adjustFormatString<int64_t>(token.vectorLongFormat);
+            }
 
+            compiledFormat->push_back(std::move(token));
+            token = {};
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            token.literal += formatString[i];
         }
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
-    print(output.get());
+    if (!token.literal.empty() || compiledFormat->empty()) {
+        compiledFormat->push_back(std::move(token));
+    }
+    return compiledFormat;
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
@@ -118,57 +233,43 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
-template <>
-void PrintFormatter::adjustFormatString<int64_t>(std::string &formatString) {
-    auto longPosition = formatString.find('l');
-
-    if (longPosition == std::string::npos) {
-        return;
-    }
-    UNRECOVERABLE_IF(formatString.size() - 1 == longPosition);
-
-    if (formatString.at(longPosition + 1) != 'l') {
-        formatString.insert(longPosition, "l");
-    }
-}
-
-size_t PrintFormatter::printToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printToken(char *output, size_t size, const PrintfFormatToken &token) {
     PrintfDataType type(PrintfDataType::invalidType);
     read(&type);
 
     switch (type) {
     case PrintfDataType::byteType:
-        return typedPrintToken<int8_t>(output, size, formatString);
+        return typedPrintToken<int8_t>(output, size, token);
     case PrintfDataType::shortType:
-        return typedPrintToken<int16_t>(output, size, formatString);
+        return typedPrintToken<int16_t>(output, size, token);
     case PrintfDataType::intType:
-        return typedPrintToken<int>(output, size, formatString);
+        return typedPrintToken<int>(output, size, token);
     case PrintfDataType::floatType:
-        return typedPrintToken<float>(output, size, formatString);
+        return typedPrintToken<float>(output, size, token);
     case PrintfDataType::longType:
-        return typedPrintToken<int64_t>(output, size, formatString);
+        return typedPrintToken<int64_t>(output, size, token);
     case PrintfDataType::pointerType:
-        return printPointerToken(output, size, formatString);
+        return printPointerToken(output, size, token);
     case PrintfDataType::doubleType:
-        return typedPrintToken<double>(output, size, formatString);
+        return typedPrintToken<double>(output, size, token);
     case PrintfDataType::vectorByteType:
-        return typedPrintVectorToken<int8_t>(output, size, formatString);
+        return typedPrintVectorToken<int8_t>(output, size, token);
     case PrintfDataType::vectorShortType:
-        return typedPrintVectorToken<int16_t>(output, size, formatString);
+        return typedPrintVectorToken<int16_t>(output, size, token);
     case PrintfDataType::vectorIntType:
-        return typedPrintVectorToken<int>(output, size, formatString);
+        return typedPrintVectorToken<int>(output, size, token);
     case PrintfDataType::vectorLongType:
-        return typedPrintVectorToken<int64_t>(output, size, formatString);
+        return typedPrintVectorToken<int64_t>(output, size, token);
     case PrintfDataType::vectorFloatType:
-        return typedPrintVectorToken<float>(output, size, formatString);
+        return typedPrintVectorToken<float>(output, size, token);
     case PrintfDataType::vectorDoubleType:
-        return typedPrintVectorToken<double>(output, size, formatString);
+        return typedPrintVectorToken<double>(output, size, token);
     default:
         return 0;
     }
 }
 
-size_t PrintFormatter::printStringToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printStringToken(char *output, size_t size, const PrintfFormatToken &token) {
     PrintfDataType type = PrintfDataType::invalidType;
     read(&type);
 
@@ -183,14 +284,14 @@ size_t PrintFormatter::printStringToken(char *output, size_t size, const char *f
 
     switch (type) {
     default:
-        return simpleSprintf(output, size, formatString, 0);
+        return simpleSprintf(output, size, token.format.c_str(), 0);
     case PrintfDataType::stringType:
     case PrintfDataType::pointerType:
-        return simpleSprintf(output, size, formatString, string);
+        return simpleSprintf(output, size, token.format.c_str(), string);
     }
 }
 
-size_t PrintFormatter::printPointerToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printPointerToken(char *output, size_t size, const PrintfFormatToken &token) {
     uint64_t value = {0};
     read(&value);
 
@@ -198,7 +299,7 @@ size_t PrintFormatter::printPointerToken(char *output, size_t size, const char *
         value &= 0x00000000FFFFFFFF;
     }
 
-    return simpleSprintf(output, size, formatString, value);
+    return simpleSprintf(output, size, token.format.c_str(), value);
 }
 
 const char *PrintFormatter::queryPrintfString(uint32_t index) const {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,14 +9,19 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/os_interface/print.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count); // NOLINT(readability-identifier-naming)
 
@@ -43,27 +48,58 @@ enum class PrintfDataType : int {
 };
 static_assert(sizeof(PrintfDataType) == sizeof(int));
 
+// Literal text followed by a single conversion specification, pre-parsed from a printf format string.
+struct PrintfFormatToken {
+    std::string literal;
+    std::string format;
+    std::string longFormat;
+    std::string vectorFormat;
+    std::string vectorLongFormat;
+    bool hasConversion = false;
+    bool isString = false;
+};
+using CompiledPrintfFormat = std::vector<PrintfFormatToken>;
+
+// Keeps format strings parsed once per kernel instead of once per printf call. Keys are format string addresses,
+// so the cache must not outlive the strings it was filled from.
+class PrintfFormatCache {
+  public:
+    const CompiledPrintfFormat &get(const char *formatString);
+    size_t getCompiledFormatsCount();
+
+  protected:
+    std::mutex mtx;
+    std::unordered_map<const char *, std::unique_ptr<CompiledPrintfFormat>> compiledFormats;
+};
+
 class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
+                   bool using32BitPointers, const StringMap *stringLiteralMap = nullptr, PrintfFormatCache *formatCache = nullptr);
     void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToStdout(str); });
     void setInitialOffset(uint32_t offset) {
         initialOffset = offset;
     }
+    static std::unique_ptr<CompiledPrintfFormat> compileFormatString(const char *formatString);
+
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
+    constexpr static size_t streamingOutputBufferSize = MemoryConstants::megaByte;
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
+    const CompiledPrintfFormat &getCompiledFormat(const char *formatString);
     void printString(const char *formatString, const std::function<void(char *)> &print);
-    size_t printToken(char *output, size_t size, const char *formatString);
-    size_t printStringToken(char *output, size_t size, const char *formatString);
-    size_t printPointerToken(char *output, size_t size, const char *formatString);
-
-    char escapeChar(char escape);
-    bool isConversionSpecifier(char c);
-    void stripVectorFormat(const char *format, char *stripped);
-    void stripVectorTypeConversion(char *format);
+    void appendLiteral(const std::string &literal);
+    void commitPrinted(size_t printed);
+    void flushOutput(const std::function<void(char *)> &print);
+    size_t printToken(char *output, size_t size, const PrintfFormatToken &token);
+    size_t printStringToken(char *output, size_t size, const PrintfFormatToken &token);
+    size_t printPointerToken(char *output, size_t size, const PrintfFormatToken &token);
+
+    static char escapeChar(char escape);
+    static bool isConversionSpecifier(char c);
+    static void stripVectorFormat(const char *format, char *stripped);
+    static void stripVectorTypeConversion(char *format);
 
     template <class T>
     bool read(T *value) {
@@ -83,37 +119,39 @@ class PrintFormatter {
     }
 
     template <class T>
-    void adjustFormatString(std::string &formatString) {}
+    static void adjustFormatString(std::string &formatString) {}
 
     template <class T>
-    size_t typedPrintToken(char *output, size_t size, const char *inputFormatString) {
+    static const std::string &selectFormat(const std::string &format, const std::string &longFormat) {
+        if constexpr (std::is_same_v<T, int64_t>) {
+            UNRECOVERABLE_IF(longFormat.empty());
+            return longFormat;
+        }
+        return format;
+    }
+
+    template <class T>
+    size_t typedPrintToken(char *output, size_t size, const PrintfFormatToken &token) {
         T value{0};
         read(&value);
         currentOffset = alignUp(currentOffset, sizeof(uint32_t));
-        std::string formatString(inputFormatString);
-        adjustFormatString<T>(formatString);
-        return simpleSprintf(output, size, formatString.c_str(), value);
+        return simpleSprintf(output, size, selectFormat<T>(token.format, token.longFormat).c_str(), value);
     }
 
     template <class T>
-    size_t typedPrintVectorToken(char *output, size_t size, const char *inputFormatString) {
+    size_t typedPrintVectorToken(char *output, size_t size, const PrintfFormatToken &token) {
         T value = {0};
         int valueCount = 0;
         read(&valueCount);
 
         size_t charactersPrinted = 0;
-        char strippedFormat[1024]{};
-
-        stripVectorFormat(inputFormatString, strippedFormat);
-        stripVectorTypeConversion(strippedFormat);
-        std::string formatString(strippedFormat);
-        adjustFormatString<T>(formatString);
+        auto &formatString = selectFormat<T>(token.vectorFormat, token.vectorLongFormat);
 
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString.c_str(), value);
+            charactersPrinted = std::min(charactersPrinted + simpleSprintf(output + charactersPrinted, size - charactersPrinted, formatString.c_str(), value), size - 1);
             if (i < valueCount - 1) {
-                charactersPrinted += simpleSprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
+                charactersPrinted = std::min(charactersPrinted + simpleSprintf(output + charactersPrinted, size - charactersPrinted, "%c", ','), size - 1);
             }
         }
 
@@ -125,6 +163,11 @@ class PrintFormatter {
     }
 
     std::unique_ptr<char[]> output;
+    size_t outputSize = 0;
+    size_t outputUsed = 0;  // characters formatted into output and not flushed yet
+    size_t statementEnd = 0; // output limit of the currently formatted printf call
+    bool statementTerminated = false;
+    bool streamingOutput = false;
 
     const uint8_t *printfOutputBuffer = nullptr; // buffer extracted from the kernel, contains values to be printed
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
@@ -133,6 +176,11 @@ class PrintFormatter {
     const bool usesStringMap;
     const StringMap *stringLiteralMap;
 
+    PrintfFormatCache ownFormatCache;
+    PrintfFormatCache *formatCache = nullptr;
+    const char *lastFormatString = nullptr;
+    const CompiledPrintfFormat *lastCompiledFormat = nullptr;
+
     uint32_t currentOffset = 0; // current position in currently parsed buffer
     uint32_t initialOffset = 0; // initial offset - reserved memory for header in buffer
 };
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/printf_output_worker.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+namespace NEO {
+
+PrintfOutputWorker::PrintfOutputWorker() {
+    thread = Thread::create(run, reinterpret_cast<void *>(this));
+}
+
+PrintfOutputWorker::~PrintfOutputWorker() {
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        active = false;
+    }
+    jobsCondition.notify_one();
+    thread->join();
+}
+
+void PrintfOutputWorker::enqueue(Job &&job) {
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        jobs.push_back(std::move(job));
+    }
+    jobsCondition.notify_one();
+}
+
+void PrintfOutputWorker::drain() {
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    drainCondition.wait(lock, [this] { return jobs.empty() && !busy; });
+}
+
+void *PrintfOutputWorker::run(void *arg) {
+    auto self = reinterpret_cast<PrintfOutputWorker *>(arg);
+    std::unique_lock<std::mutex> lock(self->jobsMutex);
+
+    while (true) {
+        self->jobsCondition.wait(lock, [self] { return !self->jobs.empty() || !self->active; });
+        // pending output is printed before the worker stops
+        if (self->jobs.empty()) {
+            break;
+        }
+
+        auto job = std::move(self->jobs.front());
+        self->jobs.pop_front();
+        self->busy = true;
+        lock.unlock();
+
+        job();
+
+        lock.lock();
+        self->busy = false;
+        if (self->jobs.empty()) {
+            self->drainCondition.notify_all();
+        }
+    }
+    return nullptr;
+}
+} // namespace NEO
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class Thread;
+
+// Formats and prints kernel printf output on a background thread, in submission order.
+class PrintfOutputWorker {
+  public:
+    using Job = std::function<void()>;
+
+    PrintfOutputWorker();
+    MOCKABLE_VIRTUAL ~PrintfOutputWorker();
+
+    PrintfOutputWorker(const PrintfOutputWorker &) = delete;
+    PrintfOutputWorker &operator=(const PrintfOutputWorker &) = delete;
+
+    void enqueue(Job &&job);
+    // Blocks until all enqueued jobs are printed.
+    void drain();
+
+  protected:
+    static void *run(void *arg);
+
+    std::unique_ptr<Thread> thread;
+    std::deque<Job> jobs;
+    std::mutex jobsMutex;
+    std::condition_variable jobsCondition;
+    std::condition_variable drainCondition;
+    bool busy = false;
+    bool active = true;
+};
+} // namespace NEO
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/submission_tracer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace NEO {
+
+uint32_t LatencyHistogram::getBucketIndex(uint64_t value) {
+    if (value < linearRange) {
+        return static_cast<uint32_t>(value);
+    }
+    auto exponent = Math::log2(value);
+    auto subBucket = static_cast<uint32_t>(value >> (exponent - subBucketBits)) & (subBucketsPerPower - 1);
+    return linearRange + (exponent - linearRangeBits) * subBucketsPerPower + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketLowerBound(uint32_t bucketIndex) {
+    if (bucketIndex < linearRange) {
+        return bucketIndex;
+    }
+    auto relativeIndex = bucketIndex - linearRange;
+    auto exponent = relativeIndex / subBucketsPerPower + linearRangeBits;
+    uint64_t subBucket = relativeIndex % subBucketsPerPower;
+    return (1ull << exponent) | (subBucket << (exponent - subBucketBits));
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    add(buckets[getBucketIndex(value)], 1);
+    add(count, 1);
+    add(sum, value);
+    if (value > maxValue.load(std::memory_order_relaxed)) {
+        maxValue.store(value, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+    for (uint32_t i = 0; i < bucketsCount; i++) {
+        add(buckets[i], other.getBucketCount(i));
+    }
+    add(count, other.getCount());
+    add(sum, other.getSum());
+    if (other.getMax() > getMax()) {
+        maxValue.store(other.getMax(), std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (auto &bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    maxValue.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const {
+    auto totalCount = getCount();
+    if (totalCount == 0) {
+        return 0;
+    }
+    auto target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(totalCount)));
+    target = std::max(target, static_cast<uint64_t>(1));
+
+    uint64_t accumulated = 0;
+    for (uint32_t i = 0; i < bucketsCount; i++) {
+        accumulated += getBucketCount(i);
+        if (accumulated >= target) {
+            return getBucketLowerBound(i);
+        }
+    }
+    return getMax();
+}
+
+SubmissionTracer &SubmissionTracer::get() {
+    static SubmissionTracer submissionTracer;
+    return submissionTracer;
+}
+
+bool SubmissionTracer::isEnabled() {
+    return debugManager.flags.EnableSubmissionTracing.get() >= 1;
+}
+
+const char *SubmissionTracer::getStageName(SubmissionStage stage) {
+    switch (stage) {
+    case SubmissionStage::argumentPatching:
+        return "argumentPatching";
+    case SubmissionStage::dispatchEncoding:
+        return "dispatchEncoding";
+    case SubmissionStage::residency:
+        return "residency";
+    case SubmissionStage::flushTask:
+        return "flushTask";
+    case SubmissionStage::flushImmediateTask:
+        return "flushImmediateTask";
+    case SubmissionStage::ringAppend:
+        return "ringAppend";
+    case SubmissionStage::hostWait:
+        return "hostWait";
+    default:
+        UNRECOVERABLE_IF(true);
+        return "";
+    }
+}
+
+SubmissionTracer::~SubmissionTracer() {
+    if (debugManager.flags.EnableSubmissionTracing.get() == 2) {
+        dump(std::cout);
+    }
+}
+
+SubmissionTracer::StageHistograms &SubmissionTracer::getThreadHistograms() {
+    static thread_local StageHistograms *histograms = nullptr;
+    if (histograms == nullptr) {
+        auto newHistograms = std::make_unique<StageHistograms>();
+        histograms = newHistograms.get();
+
+        std::lock_guard<std::mutex> lock(mtx);
+        threadHistograms.push_back(std::move(newHistograms));
+    }
+    return *histograms;
+}
+
+void SubmissionTracer::record(SubmissionStage stage, uint64_t ticks) {
+    getThreadHistograms()[static_cast<uint32_t>(stage)].record(ticks);
+}
+
+std::unique_ptr<SubmissionTracer::StageHistograms> SubmissionTracer::aggregate() {
+    auto result = std::make_unique<StageHistograms>();
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &perThread : threadHistograms) {
+        for (uint32_t stage = 0; stage < stagesCount; stage++) {
+            (*result)[stage].merge((*perThread)[stage]);
+        }
+    }
+    return result;
+}
+
+void SubmissionTracer::dump(std::ostream &out) {
+    auto histograms = aggregate();
+    out << "Submission pipeline latency [CPU ticks]" << std::endl;
+    out << "stage, count, avg, p50, p90, p99, max" << std::endl;
+    for (uint32_t stage = 0; stage < stagesCount; stage++) {
+        auto &histogram = (*histograms)[stage];
+        if (histogram.getCount() == 0) {
+            continue;
+        }
+        out << getStageName(static_cast<SubmissionStage>(stage)) << ", "
+            << histogram.getCount() << ", "
+            << histogram.getSum() / histogram.getCount() << ", "
+            << histogram.getPercentile(50.0) << ", "
+            << histogram.getPercentile(90.0) << ", "
+            << histogram.getPercentile(99.0) << ", "
+            << histogram.getMax() << std::endl;
+    }
+}
+
+void SubmissionTracer::reset() {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &perThread : threadHistograms) {
+        for (auto &histogram : *perThread) {
+            histogram.reset();
+        }
+    }
+}
+
+} // namespace NEO
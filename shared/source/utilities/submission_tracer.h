@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+
+enum class SubmissionStage : uint32_t {
+    argumentPatching = 0,
+    dispatchEncoding,
+    residency,
+    flushTask,
+    flushImmediateTask,
+    ringAppend,
+    hostWait,
+    count
+};
+
+class LatencyHistogram {
+  public:
+    // Values below linearRange land in exact buckets, larger values are grouped by
+    // power of two and split into subBucketsPerPower linear sub-buckets (HDR-style).
+    static constexpr uint32_t linearRangeBits = 4;
+    static constexpr uint32_t linearRange = 1u << linearRangeBits;
+    static constexpr uint32_t subBucketBits = 3;
+    static constexpr uint32_t subBucketsPerPower = 1u << subBucketBits;
+    static constexpr uint32_t bucketsCount = linearRange + (64 - linearRangeBits) * subBucketsPerPower;
+
+    static uint32_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketLowerBound(uint32_t bucketIndex);
+
+    void record(uint64_t value);
+    void merge(const LatencyHistogram &other);
+    void reset();
+
+    uint64_t getCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t getSum() const { return sum.load(std::memory_order_relaxed); }
+    uint64_t getMax() const { return maxValue.load(std::memory_order_relaxed); }
+    uint64_t getBucketCount(uint32_t bucketIndex) const { return buckets[bucketIndex].load(std::memory_order_relaxed); }
+    uint64_t getPercentile(double percentile) const;
+
+  protected:
+    // Each histogram has a single writer, so plain load/store pairs are sufficient.
+    static void add(std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, bucketsCount> buckets = {};
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> maxValue{0};
+};
+
+class SubmissionTracer {
+  public:
+    static constexpr uint32_t stagesCount = static_cast<uint32_t>(SubmissionStage::count);
+    using StageHistograms = std::array<LatencyHistogram, stagesCount>;
+
+    static SubmissionTracer &get();
+    static bool isEnabled();
+    static const char *getStageName(SubmissionStage stage);
+
+    ~SubmissionTracer();
+
+    void record(SubmissionStage stage, uint64_t ticks);
+    std::unique_ptr<StageHistograms> aggregate();
+    void dump(std::ostream &out);
+    void reset();
+
+  protected:
+    StageHistograms &getThreadHistograms();
+
+    std::mutex mtx;
+    std::vector<std::unique_ptr<StageHistograms>> threadHistograms;
+};
+
+class SubmissionTraceScope {
+  public:
+    SubmissionTraceScope(SubmissionStage stage) : stage(stage) {
+        if (SubmissionTracer::isEnabled()) {
+            start = CpuIntrinsics::rdtsc();
+            enabled = true;
+        }
+    }
+
+    ~SubmissionTraceScope() {
+        if (enabled) {
+            SubmissionTracer::get().record(stage, CpuIntrinsics::rdtsc() - start);
+        }
+    }
+
+    SubmissionTraceScope(const SubmissionTraceScope &) = delete;
+    SubmissionTraceScope &operator=(const SubmissionTraceScope &) = delete;
+
+  protected:
+    uint64_t start = 0;
+    SubmissionStage stage;
+    bool enabled = false;
+};
+
+} // namespace NEO
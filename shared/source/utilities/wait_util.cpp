@@ -8,8 +8,12 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/sleep.h"
 #include "shared/source/utilities/cpu_info.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace NEO {
 
 namespace WaitUtils {
@@ -58,6 +62,54 @@ void init() {
     }
 }
 
+HybridWaitPolicy::HybridWaitPolicy(const CompletionTimeEstimator &estimator, uint64_t timeoutNs) : timeoutNs(timeoutNs) {
+    auto estimateNs = estimator.getEstimateNs();
+    spinBudgetNs = std::clamp(estimateNs, minSpinBudgetNs, maxSpinBudgetNs);
+    monitorWaitBudgetNs = std::clamp(4 * estimateNs, spinBudgetNs, maxMonitorWaitBudgetNs);
+}
+
+HybridWaitPolicy::Phase HybridWaitPolicy::getPhase(uint64_t elapsedNs) const {
+    if (elapsedNs < spinBudgetNs) {
+        return Phase::spin;
+    }
+    if (elapsedNs < monitorWaitBudgetNs) {
+        return Phase::monitorWait;
+    }
+    return Phase::backoff;
+}
+
+void HybridWaitPolicy::wait(volatile void const *pollAddress, uint64_t elapsedNs) {
+    switch (getPhase(elapsedNs)) {
+    case Phase::spin:
+        CpuIntrinsics::pause();
+        break;
+    case Phase::monitorWait:
+        if (waitpkgUse && pollAddress != nullptr) {
+            monitorWait(pollAddress, 0);
+        } else {
+            std::this_thread::yield();
+        }
+        break;
+    case Phase::backoff: {
+        // the last sleep is shortened to the time left, so a finite timeout is not overshot
+        auto sleepUs = backoffUs;
+        if (timeoutNs != std::numeric_limits<uint64_t>::max()) {
+            auto remainingUs = timeoutNs > elapsedNs ? (timeoutNs - elapsedNs) / 1000u : 0u;
+            sleepUs = std::min(sleepUs, remainingUs);
+        }
+        lastBackoffUs = sleepUs;
+        if (sleepUs == 0) {
+            std::this_thread::yield();
+            break;
+        }
+        NEO::sleep(std::chrono::microseconds(sleepUs));
+        backoffUs = std::min(backoffUs * 2, maxBackoffUs);
+        backoffCount++;
+        break;
+    }
+    }
+}
+
 } // namespace WaitUtils
 
 } // namespace NEO
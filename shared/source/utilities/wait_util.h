@@ -9,8 +9,10 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <thread>
 
 namespace NEO {
@@ -60,6 +62,57 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
 }
 
 void init();
+
+class CompletionTimeEstimator {
+  public:
+    static constexpr uint64_t initialEstimateNs = 20000u;
+    static constexpr uint64_t weightShift = 3u;
+
+    void update(uint64_t observedWaitNs) {
+        auto current = estimateNs.load(std::memory_order_relaxed);
+        estimateNs.store(current - (current >> weightShift) + (observedWaitNs >> weightShift), std::memory_order_relaxed);
+    }
+
+    uint64_t getEstimateNs() const {
+        return estimateNs.load(std::memory_order_relaxed);
+    }
+
+  protected:
+    std::atomic<uint64_t> estimateNs{initialEstimateNs};
+};
+
+class HybridWaitPolicy {
+  public:
+    enum class Phase {
+        spin,
+        monitorWait,
+        backoff
+    };
+
+    static constexpr uint64_t minSpinBudgetNs = 2000u;
+    static constexpr uint64_t maxSpinBudgetNs = 100000u;
+    static constexpr uint64_t maxMonitorWaitBudgetNs = 1000000u;
+    static constexpr uint64_t minBackoffUs = 10u;
+    static constexpr uint64_t maxBackoffUs = 1000u;
+
+    HybridWaitPolicy(const CompletionTimeEstimator &estimator, uint64_t timeoutNs = std::numeric_limits<uint64_t>::max());
+
+    Phase getPhase(uint64_t elapsedNs) const;
+    void wait(volatile void const *pollAddress, uint64_t elapsedNs);
+
+    uint64_t getSpinBudgetNs() const { return spinBudgetNs; }
+    uint64_t getMonitorWaitBudgetNs() const { return monitorWaitBudgetNs; }
+    uint32_t getBackoffCount() const { return backoffCount; }
+    uint64_t getLastBackoffUs() const { return lastBackoffUs; }
+
+  protected:
+    uint64_t spinBudgetNs = 0;
+    uint64_t monitorWaitBudgetNs = 0;
+    uint64_t timeoutNs = std::numeric_limits<uint64_t>::max();
+    uint64_t lastBackoffUs = 0;
+    uint64_t backoffUs = minBackoffUs;
+    uint32_t backoffCount = 0;
+};
 } // namespace WaitUtils
 
 } // namespace NEO
@@ -19,10 +19,15 @@ void cpuidexWindowsWrapper(int *cpuInfo, int functionId, int subfunctionId) {
     __cpuidex(cpuInfo, functionId, subfunctionId);
 }
 
+uint64_t xgetbvWindowsWrapper(uint32_t xcr) {
+    return _xgetbv(xcr);
+}
+
 void getCpuFlagsWindows(std::string &cpuFlags) {}
 
 void (*CpuInfo::cpuidexFunc)(int *, int, int) = cpuidexWindowsWrapper;
 void (*CpuInfo::cpuidFunc)(int *, int) = cpuidWindowsWrapper;
+uint64_t (*CpuInfo::xgetbvFunc)(uint32_t) = xgetbvWindowsWrapper;
 void (*CpuInfo::getCpuFlagsFunc)(std::string &) = getCpuFlagsWindows;
 
 const CpuInfo CpuInfo::instance;
@@ -40,4 +45,8 @@ void CpuInfo::cpuidex(
     cpuidexFunc(reinterpret_cast<int *>(cpuInfo), functionId, subfunctionId);
 }
 
+uint64_t CpuInfo::xgetbv(uint32_t xcr) const {
+    return xgetbvFunc(xcr);
+}
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,7 +22,10 @@ void CpuInfo::detect() const {
     constexpr size_t ecx = 2;
     constexpr size_t edx = 3;
 
+    constexpr uint64_t xcr0Avx512StateMask = BIT(1) | BIT(2) | BIT(5) | BIT(6) | BIT(7);
+
     uint32_t cpuInfo[4] = {};
+    bool osXSaveEnabled = false;
 
     cpuid(cpuInfo, 0u);
     auto numFunctionIds = cpuInfo[eax];
@@ -30,6 +33,7 @@ void CpuInfo::detect() const {
         cpuid(cpuInfo, processorInfo);
         {
             features |= cpuInfo[edx] & BIT(19) ? featureClflush : featureNone;
+            osXSaveEnabled = cpuInfo[ecx] & BIT(27);
         }
     }
 
@@ -39,6 +43,12 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[ebx] & mask) == mask ? featureAvX2 : featureNone;
 
+            // AVX-512 needs the OS to save opmask and ZMM state (XCR0 bits 5-7) in addition to SSE and AVX state
+            auto avx512Mask = BIT(16) | BIT(30);
+            if ((cpuInfo[ebx] & avx512Mask) == avx512Mask && osXSaveEnabled) {
+                features |= (xgetbv(0) & xcr0Avx512StateMask) == xcr0Avx512StateMask ? featureAvX512Bw : featureNone;
+            }
+
             features |= (cpuInfo[ecx] & BIT(5)) ? featureWaitPkg : featureNone;
         }
     }
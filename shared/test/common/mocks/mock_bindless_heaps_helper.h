@@ -34,15 +34,19 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::borderColorStates;
     using BaseClass::globalBindlessDsh;
     using BaseClass::growHeap;
+    using BaseClass::heapGrowCount;
     using BaseClass::isMultiOsContextCapable;
     using BaseClass::memManager;
     using BaseClass::releasePoolIndex;
+    using BaseClass::reusedSlotsCount;
+    using BaseClass::reusedSurfaceStatesCount;
     using BaseClass::reuseSlotCountThreshold;
     using BaseClass::rootDeviceIndex;
     using BaseClass::ssHeapsAllocations;
     using BaseClass::stateCacheDirtyForContext;
     using BaseClass::surfaceStateHeaps;
     using BaseClass::surfaceStateInHeapVectorReuse;
+    using BaseClass::surfaceStateReuseMtx;
     using BaseClass::surfaceStateSize;
 
     IndirectHeap *specialSsh;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -220,6 +220,22 @@ __kernel void FillBufferSSHOffset(
     pDst[dstIndex] = pSrc[srcIndex];
 }
 
+__kernel void FillBufferGeneric(
+    __global uchar* pDst,
+    ulong dstOffsetInBytes,
+    ulong sizeInBytes,
+    const __global uchar* pPattern,
+    const uint patternSizeInBytes )
+{
+    ulong begin = get_global_id(0) * 16;
+    ulong end = min(begin + 16, sizeInBytes);
+    uint patternIndex = begin % patternSizeInBytes;
+    for (ulong i = begin; i < end; i++) {
+        pDst[ i + dstOffsetInBytes ] = pPattern[ patternIndex ];
+        patternIndex = (patternIndex + 1 == patternSizeInBytes) ? 0 : patternIndex + 1;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 __kernel void CopyBufferRectBytes2d(
     __global const char* src,
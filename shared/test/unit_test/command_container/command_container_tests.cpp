@@ -1084,6 +1084,61 @@ HWTEST_F(CommandContainerTest, givenCmdContainerWhenReuseExistingCmdBufferWithAl
     allocList.freeAllGraphicsAllocations(pDevice);
 }
 
+HWTEST_F(CommandContainerTest, givenCmdContainerWhenReuseExistingCmdBufferWithEmptyImmediateListAndReadyAllocationInSharedListThenReturnAllocFromSharedList) {
+    auto cmdContainer = std::make_unique<MyMockCommandContainer>();
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.tagAddress = 10u;
+
+    AllocationsList allocList;
+    cmdContainer->initialize(pDevice, &allocList, HeapSize::defaultHeapSize, false, false);
+    cmdContainer->setImmediateCmdListCsr(&csr);
+    cmdContainer->immediateReusableAllocationList = std::make_unique<NEO::AllocationsList>();
+
+    auto sharedAllocation = CommandContainer::createCommandBufferAllocation(*pDevice, cmdContainer->getAlignedCmdBufferSize(), false);
+    ASSERT_NE(nullptr, sharedAllocation);
+    allocList.pushTailOne(*sharedAllocation);
+
+    auto currectContainerSize = cmdContainer->getCmdBufferAllocations().size();
+    EXPECT_EQ(sharedAllocation, cmdContainer->reuseExistingCmdBuffer());
+    EXPECT_EQ(cmdContainer->getCmdBufferAllocations().size(), currectContainerSize + 1);
+    EXPECT_TRUE(allocList.peekIsEmpty());
+
+    cmdContainer.reset();
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenPrewarmedReusableListWhenCmdContainerIsInitializedThenCommandBufferIsNotAllocated) {
+    AllocationsList allocList;
+    EXPECT_EQ(2u, CommandContainer::prewarmReusableCmdBuffers(*pDevice, allocList, 2u));
+    EXPECT_FALSE(allocList.peekIsEmpty());
+
+    auto cmdContainer = std::make_unique<MyMockCommandContainer>();
+    auto code = cmdContainer->initialize(pDevice, &allocList, HeapSize::defaultHeapSize, false, false);
+    EXPECT_EQ(CommandContainer::ErrorCode::success, code);
+    EXPECT_EQ(0u, cmdContainer->allocateCommandBufferCalled[0]);
+
+    cmdContainer->allocateNextCommandBuffer();
+    EXPECT_EQ(0u, cmdContainer->allocateCommandBufferCalled[0]);
+    EXPECT_TRUE(allocList.peekIsEmpty());
+
+    cmdContainer->allocateNextCommandBuffer();
+    EXPECT_EQ(1u, cmdContainer->allocateCommandBufferCalled[0]);
+
+    cmdContainer.reset();
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenFailingAllocationWhenPrewarmingReusableCmdBuffersThenPrewarmingStopsAndAllocatedAmountIsReturned) {
+    auto memoryManager = static_cast<MockMemoryManager *>(pDevice->getMemoryManager());
+    memoryManager->maxSuccessAllocatedGraphicsMemoryIndex = memoryManager->successAllocatedGraphicsMemoryIndex + 1;
+
+    AllocationsList allocList;
+    EXPECT_EQ(1u, CommandContainer::prewarmReusableCmdBuffers(*pDevice, allocList, 2u));
+    EXPECT_FALSE(allocList.peekIsEmpty());
+
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
 TEST_F(CommandContainerTest, GivenCmdContainerWhenContainerIsInitializedThenSurfaceStateIndirectHeapSizeIsCorrect) {
     MyMockCommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/indirect_data_cache.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+
+using namespace NEO;
+
+struct IndirectDataCacheFixture {
+    void setUp() {
+        heap = std::make_unique<IndirectHeap>(&heapAllocation);
+        for (auto i = 0u; i < crossThreadData.size(); i++) {
+            crossThreadData[i] = static_cast<uint8_t>(i);
+        }
+        perThreadData.fill(0xau);
+    }
+    void tearDown() {}
+
+    IndirectDataBlock getIndirectData() const {
+        return {crossThreadData.data(), static_cast<uint32_t>(crossThreadData.size()), perThreadData.data(), static_cast<uint32_t>(perThreadData.size())};
+    }
+
+    void writeToHeap(IndirectDataCache &cache, uint64_t &offsetThreadData) {
+        offsetThreadData = heap->getUsed();
+        heap->getSpace(getIndirectData().getSize());
+        cache.recordWrite(getIndirectData().getSize());
+        cache.store(dispatchKey, *heap, getIndirectData(), offsetThreadData);
+    }
+
+    std::array<uint8_t, 4096> heapStorage{};
+    MockGraphicsAllocation heapAllocation{heapStorage.data(), heapStorage.size()};
+    std::unique_ptr<IndirectHeap> heap;
+    std::array<uint8_t, 1024> crossThreadData{};
+    std::array<uint8_t, 64> perThreadData{};
+    const void *dispatchKey = reinterpret_cast<const void *>(0x1000);
+};
+
+using IndirectDataCacheTests = Test<IndirectDataCacheFixture>;
+
+TEST_F(IndirectDataCacheTests, givenUnchangedIndirectDataWhenDispatchedAgainThenPreviousOffsetIsReused) {
+    IndirectDataCache cache;
+    uint64_t offsetThreadData = 0u;
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+
+    heap->getSpace(64u);
+    uint64_t writtenOffset = 0u;
+    writeToHeap(cache, writtenOffset);
+    EXPECT_EQ(getIndirectData().getSize(), cache.getLastLaunchBytesWritten());
+
+    EXPECT_TRUE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+    EXPECT_EQ(writtenOffset, offsetThreadData);
+    EXPECT_EQ(0u, cache.getLastLaunchBytesWritten());
+    EXPECT_EQ(getIndirectData().getSize(), cache.getTotalBytesWritten());
+    EXPECT_EQ(getIndirectData().getSize(), cache.getTotalBytesReused());
+    EXPECT_EQ(1u, cache.getReusedLaunchesCount());
+}
+
+TEST_F(IndirectDataCacheTests, givenChangedCrossThreadOrPerThreadDataWhenDispatchedAgainThenDataIsNotReused) {
+    IndirectDataCache cache;
+    uint64_t offsetThreadData = 0u;
+    writeToHeap(cache, offsetThreadData);
+
+    crossThreadData[crossThreadData.size() - 1]++;
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+    crossThreadData[crossThreadData.size() - 1]--;
+
+    perThreadData[0]++;
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+    perThreadData[0]--;
+
+    auto shorterData = getIndirectData();
+    shorterData.crossThreadDataSize--;
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, shorterData, offsetThreadData));
+
+    EXPECT_FALSE(cache.reuse(reinterpret_cast<const void *>(0x2000), *heap, getIndirectData(), offsetThreadData));
+    EXPECT_TRUE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+}
+
+TEST_F(IndirectDataCacheTests, givenHeapReplacedOrRewoundWhenDispatchedAgainThenDataIsNotReused) {
+    IndirectDataCache cache;
+    uint64_t offsetThreadData = 0u;
+    writeToHeap(cache, offsetThreadData);
+
+    std::array<uint8_t, 4096> otherHeapStorage{};
+    MockGraphicsAllocation otherHeapAllocation{otherHeapStorage.data(), otherHeapStorage.size()};
+    IndirectHeap otherHeap(&otherHeapAllocation);
+    otherHeap.getSpace(heap->getUsed());
+    EXPECT_FALSE(cache.reuse(dispatchKey, otherHeap, getIndirectData(), offsetThreadData));
+
+    heap->replaceBuffer(heap->getCpuBase(), heap->getMaxAvailableSpace());
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+
+}
+
+TEST_F(IndirectDataCacheTests, givenClearedCacheWhenDispatchedAgainThenDataIsNotReused) {
+    IndirectDataCache cache;
+    uint64_t offsetThreadData = 0u;
+    writeToHeap(cache, offsetThreadData);
+    EXPECT_TRUE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+
+    cache.clear();
+    EXPECT_FALSE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+}
+
+TEST_F(IndirectDataCacheTests, givenMoreDispatchKeysThanLimitWhenStoringThenLeastRecentlyUsedEntryIsDropped) {
+    IndirectDataCache cache(2u);
+    const void *otherKeys[] = {reinterpret_cast<const void *>(0x2000), reinterpret_cast<const void *>(0x3000)};
+    uint64_t offsetThreadData = 0u;
+
+    writeToHeap(cache, offsetThreadData);
+    cache.store(otherKeys[0], *heap, getIndirectData(), offsetThreadData);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+
+    EXPECT_TRUE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+    cache.store(otherKeys[1], *heap, getIndirectData(), offsetThreadData);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+    EXPECT_FALSE(cache.reuse(otherKeys[0], *heap, getIndirectData(), offsetThreadData));
+    EXPECT_TRUE(cache.reuse(dispatchKey, *heap, getIndirectData(), offsetThreadData));
+    EXPECT_TRUE(cache.reuse(otherKeys[1], *heap, getIndirectData(), offsetThreadData));
+
+    cache.store(otherKeys[1], *heap, getIndirectData(), offsetThreadData);
+    EXPECT_EQ(2u, cache.getEntriesCount());
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    cache.store(otherKeys[0], *heap, getIndirectData(), offsetThreadData);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+}
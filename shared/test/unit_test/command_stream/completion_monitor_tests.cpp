@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/completion_monitor.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct CompletionMonitorTest : public ::testing::Test {
+    void SetUp() override {
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, 1);
+        csr->tagAddress = &tag;
+        csr->isGpuHangDetectedReturnValue = false;
+    }
+
+    void TearDown() override {
+        csr.reset();
+    }
+
+    volatile TagAddressType tag = 0;
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+};
+
+TEST_F(CompletionMonitorTest, givenTaskCountAlreadyReachedWhenWaitingThenReadyIsReturnedWithoutRegisteringWaiter) {
+    tag = 5;
+    CompletionMonitor completionMonitor(*csr);
+
+    EXPECT_EQ(WaitStatus::ready, completionMonitor.waitForTaskCount(WaitParams{false, false, 0}, 5));
+    EXPECT_EQ(0u, completionMonitor.getWaitersCount());
+    EXPECT_EQ(0u, completionMonitor.getPollsCount());
+}
+
+TEST_F(CompletionMonitorTest, givenTaskCountNotReachedWhenWaitingWithTimeoutThenNotReadyIsReturnedAndWaiterIsRemoved) {
+    CompletionMonitor completionMonitor(*csr);
+
+    EXPECT_EQ(WaitStatus::notReady, completionMonitor.waitForTaskCount(WaitParams{false, true, 1000}, 1));
+    EXPECT_EQ(0u, completionMonitor.getWaitersCount());
+}
+
+TEST_F(CompletionMonitorTest, givenGpuHangWhenWaitingThenGpuHangIsReturned) {
+    csr->isGpuHangDetectedReturnValue = true;
+    CompletionMonitor completionMonitor(*csr);
+
+    EXPECT_EQ(WaitStatus::gpuHang, completionMonitor.waitForTaskCount(WaitParams{false, false, 0}, 1));
+    EXPECT_EQ(0u, completionMonitor.getWaitersCount());
+}
+
+TEST_F(CompletionMonitorTest, givenManyWaiterThreadsWhenTagIsUpdatedThenAllWaitersAreWokenByOneMonitor) {
+    CompletionMonitor completionMonitor(*csr);
+
+    constexpr uint32_t waitersCount = 16;
+    std::atomic<uint32_t> readyCount{0};
+    std::vector<std::thread> waiters;
+    for (uint32_t i = 0; i < waitersCount; i++) {
+        waiters.emplace_back([&, i]() {
+            if (completionMonitor.waitForTaskCount(WaitParams{false, false, 0}, i % 4 + 1) == WaitStatus::ready) {
+                readyCount++;
+            }
+        });
+    }
+
+    while (completionMonitor.getWaitersCount() != waitersCount) {
+        std::this_thread::yield();
+    }
+
+    for (TagAddressType taskCount = 1; taskCount <= 4; taskCount++) {
+        tag = taskCount;
+        while (completionMonitor.getWaitersCount() > waitersCount - taskCount * (waitersCount / 4)) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_EQ(waitersCount, readyCount.load());
+    EXPECT_EQ(0u, completionMonitor.getWaitersCount());
+}
+
+TEST_F(CompletionMonitorTest, givenCompletionMonitorEnabledWhenWaitingForCompletionThenMonitorIsCreatedOnceAndUsed) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableCompletionMonitor.set(1);
+    tag = 3;
+    csr->latestFlushedTaskCount = 3;
+
+    EXPECT_EQ(WaitStatus::ready, csr->CommandStreamReceiver::waitForCompletionWithTimeout(WaitParams{false, false, 0}, 3));
+
+    auto completionMonitor = csr->getCompletionMonitor();
+    ASSERT_NE(nullptr, completionMonitor);
+    EXPECT_EQ(completionMonitor, csr->getCompletionMonitor());
+    EXPECT_EQ(0u, completionMonitor->getWaitersCount());
+}
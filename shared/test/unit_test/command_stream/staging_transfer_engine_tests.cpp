@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/staging_transfer_engine.h"
+#include "shared/source/helpers/blit_helper.h"
+#include "shared/source/helpers/completion_stamp.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_allocation_properties.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include <memory>
+#include <vector>
+
+using namespace NEO;
+
+struct MockStagingTransferEngine : public StagingTransferEngine {
+    using StagingTransferEngine::stagingBuffers;
+    using StagingTransferEngine::StagingTransferEngine;
+};
+
+struct StagingTransferEngineTest : public DeviceFixture, public ::testing::Test {
+    void SetUp() override {
+        debugManager.flags.StagingTransferChunkSize.set(static_cast<int32_t>(chunkSize));
+        DeviceFixture::setUp();
+        gpuAllocation = pDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{pDevice->getRootDeviceIndex(), transferSize});
+        hostMemory.resize(transferSize);
+        for (size_t i = 0; i < transferSize; i++) {
+            hostMemory[i] = static_cast<uint8_t>(i / chunkSize + i);
+        }
+    }
+
+    void TearDown() override {
+        pDevice->getMemoryManager()->freeGraphicsMemory(gpuAllocation);
+        DeviceFixture::tearDown();
+    }
+
+    static constexpr size_t chunkSize = MemoryConstants::pageSize;
+    static constexpr size_t transferSize = 4 * chunkSize + 100;
+
+    DebugManagerStateRestore restorer;
+    GraphicsAllocation *gpuAllocation = nullptr;
+    std::vector<uint8_t> hostMemory;
+};
+
+HWTEST_F(StagingTransferEngineTest, givenChunkSizeWhenCheckingTransferSizeThenOnlyTransfersOfMultipleChunksAreSupported) {
+    MockStagingTransferEngine stagingTransferEngine(*pDevice);
+    EXPECT_EQ(chunkSize, stagingTransferEngine.getChunkSize());
+    EXPECT_FALSE(stagingTransferEngine.isTransferSizeSupported(StagingTransferEngine::minChunksCount * chunkSize - 1));
+    EXPECT_TRUE(stagingTransferEngine.isTransferSizeSupported(StagingTransferEngine::minChunksCount * chunkSize));
+
+    EXPECT_FALSE(StagingTransferEngine::isEnabled());
+    debugManager.flags.EnableStagingTransfers.set(1);
+    EXPECT_TRUE(StagingTransferEngine::isEnabled());
+}
+
+HWTEST_F(StagingTransferEngineTest, givenHostMemoryWhenWritingThroughStagingBuffersThenEachChunkIsCopiedToStagingBufferAndBlitted) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockStagingTransferEngine stagingTransferEngine(*pDevice);
+    const auto blitsBefore = csr.blitBufferCalled;
+
+    EXPECT_EQ(BlitOperationResult::success, stagingTransferEngine.write(csr, gpuAllocation, 0, hostMemory.data(), transferSize));
+    EXPECT_EQ(blitsBefore + 5, csr.blitBufferCalled);
+
+    auto &lastBlit = csr.receivedBlitProperties[0];
+    EXPECT_EQ(gpuAllocation, lastBlit.dstAllocation);
+    EXPECT_EQ(4 * chunkSize, lastBlit.dstOffset.x);
+    EXPECT_EQ(100u, lastBlit.copySize.x);
+
+    auto lastStagingBuffer = stagingTransferEngine.stagingBuffers[4 % StagingTransferEngine::stagingBuffersCount].allocation;
+    EXPECT_EQ(lastStagingBuffer, lastBlit.srcAllocation);
+    EXPECT_EQ(0, memcmp(lastStagingBuffer->getUnderlyingBuffer(), &hostMemory[4 * chunkSize], 100));
+    auto previousStagingBuffer = stagingTransferEngine.stagingBuffers[3 % StagingTransferEngine::stagingBuffersCount].allocation;
+    EXPECT_EQ(0, memcmp(previousStagingBuffer->getUnderlyingBuffer(), &hostMemory[3 * chunkSize], chunkSize));
+
+    for (auto &stagingBuffer : stagingTransferEngine.stagingBuffers) {
+        EXPECT_EQ(0u, stagingBuffer.taskCount);
+    }
+    auto stats = stagingTransferEngine.getLastTransferStats();
+    EXPECT_EQ(transferSize, stats.bytes);
+    EXPECT_EQ(5u, stats.chunks);
+    EXPECT_GE(stats.totalNs, stats.cpuCopyNs);
+}
+
+HWTEST_F(StagingTransferEngineTest, givenStagingBuffersWhenReadingThroughStagingBuffersThenChunksAreCopiedFromStagingBuffersToHostMemory) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockStagingTransferEngine stagingTransferEngine(*pDevice);
+    constexpr size_t readSize = StagingTransferEngine::stagingBuffersCount * chunkSize;
+
+    EXPECT_EQ(BlitOperationResult::success, stagingTransferEngine.write(csr, gpuAllocation, 0, hostMemory.data(), transferSize));
+    for (uint32_t i = 0; i < StagingTransferEngine::stagingBuffersCount; i++) {
+        memset(stagingTransferEngine.stagingBuffers[i].allocation->getUnderlyingBuffer(), 0x10 + i, chunkSize);
+    }
+    const auto blitsBefore = csr.blitBufferCalled;
+
+    std::vector<uint8_t> readMemory(readSize);
+    EXPECT_EQ(BlitOperationResult::success, stagingTransferEngine.read(csr, gpuAllocation, chunkSize, readMemory.data(), readSize));
+    EXPECT_EQ(blitsBefore + StagingTransferEngine::stagingBuffersCount, csr.blitBufferCalled);
+    EXPECT_EQ(gpuAllocation, csr.receivedBlitProperties[0].srcAllocation);
+    EXPECT_EQ(readSize, csr.receivedBlitProperties[0].srcOffset.x);
+
+    for (uint32_t i = 0; i < StagingTransferEngine::stagingBuffersCount; i++) {
+        EXPECT_EQ(0x10 + i, readMemory[i * chunkSize]);
+        EXPECT_EQ(0x10 + i, readMemory[(i + 1) * chunkSize - 1]);
+    }
+    EXPECT_EQ(3u, stagingTransferEngine.getLastTransferStats().chunks);
+}
+
+HWTEST_F(StagingTransferEngineTest, givenFailingBlitWhenTransferringThroughStagingBuffersThenErrorIsReturned) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockStagingTransferEngine stagingTransferEngine(*pDevice);
+    csr.callBaseFlushBcsTask = false;
+
+    csr.flushBcsTaskReturnValue = CompletionStamp::gpuHang;
+    EXPECT_EQ(BlitOperationResult::gpuHang, stagingTransferEngine.write(csr, gpuAllocation, 0, hostMemory.data(), transferSize));
+    EXPECT_EQ(BlitOperationResult::gpuHang, stagingTransferEngine.read(csr, gpuAllocation, 0, hostMemory.data(), transferSize));
+
+    csr.flushBcsTaskReturnValue = CompletionStamp::outOfHostMemory;
+    EXPECT_EQ(BlitOperationResult::fail, stagingTransferEngine.write(csr, gpuAllocation, 0, hostMemory.data(), transferSize));
+    EXPECT_EQ(0u, stagingTransferEngine.getLastTransferStats().chunks);
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/transfer_planner.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+// cpu: low latency and given bandwidth; copy engine and compute kernel: high latency, high bandwidth
+class SyntheticTransferCostModel : public TransferCostModel {
+  public:
+    SyntheticTransferCostModel(double cpuBytesPerNs) : cpuBytesPerNs(cpuBytesPerNs) {}
+
+    TransferCost getCost(TransferPath path, TransferDirection direction) const override {
+        if (path == TransferPath::cpu) {
+            return {100u, cpuBytesPerNs};
+        }
+        return {10000u, 10.0};
+    }
+
+    double cpuBytesPerNs;
+};
+
+constexpr uint32_t allPathsMask = getTransferPathMask(TransferPath::cpu) | getTransferPathMask(TransferPath::copyEngine) | getTransferPathMask(TransferPath::computeKernel);
+} // namespace
+
+struct TransferPlannerTest : public ::testing::Test {
+    TransferPlanner planner{std::make_unique<SyntheticTransferCostModel>(1.0)};
+};
+
+TEST_F(TransferPlannerTest, givenSizesWhenGettingSizeBucketThenPowerOfTwoBucketIsReturned) {
+    EXPECT_EQ(0u, TransferPlanner::getSizeBucket(0));
+    EXPECT_EQ(0u, TransferPlanner::getSizeBucket(1));
+    EXPECT_EQ(10u, TransferPlanner::getSizeBucket(1024));
+    EXPECT_EQ(10u, TransferPlanner::getSizeBucket(2047));
+    EXPECT_EQ(TransferPlanner::sizeBucketsCount - 1, TransferPlanner::getSizeBucket(std::numeric_limits<size_t>::max()));
+}
+
+TEST_F(TransferPlannerTest, givenNoObservationsWhenEstimatingThenPriorLinearModelIsUsed) {
+    EXPECT_EQ(100u + 1000u, planner.estimateNs(TransferPath::cpu, TransferDirection::hostToLocal, 1000));
+    EXPECT_EQ(10000u + 100u, planner.estimateNs(TransferPath::copyEngine, TransferDirection::hostToLocal, 1000));
+}
+
+TEST_F(TransferPlannerTest, givenSmallAndLargeTransfersWhenPlanningThenLatencyOrBandwidthBoundPathIsChosen) {
+    auto smallPlan = planner.plan(TransferDirection::hostToLocal, 1024, allPathsMask, false);
+    EXPECT_EQ(TransferPath::cpu, smallPlan.primaryPath);
+    EXPECT_FALSE(smallPlan.isSplit());
+    EXPECT_EQ(1024u, smallPlan.primarySize);
+
+    auto largePlan = planner.plan(TransferDirection::hostToLocal, 1024 * 1024, allPathsMask, false);
+    EXPECT_EQ(TransferPath::copyEngine, largePlan.primaryPath);
+    EXPECT_FALSE(largePlan.isSplit());
+}
+
+TEST_F(TransferPlannerTest, givenPathNotAvailableWhenPlanningThenItIsNotChosen) {
+    auto plan = planner.plan(TransferDirection::hostToLocal, 1024, getTransferPathMask(TransferPath::computeKernel), false);
+    EXPECT_EQ(TransferPath::computeKernel, plan.primaryPath);
+
+    plan = planner.plan(TransferDirection::hostToLocal, 1024, 0u, true);
+    EXPECT_EQ(TransferPath::count, plan.primaryPath);
+}
+
+TEST_F(TransferPlannerTest, givenObservedTransfersSlowerThanModelWhenRecordingThenCorrectionConvergesAndPlanChanges) {
+    EXPECT_EQ(TransferPath::cpu, planner.plan(TransferDirection::localToHost, 4096, allPathsMask, false).primaryPath);
+
+    for (uint32_t i = 0; i < 100; i++) {
+        planner.recordTransfer(TransferPath::cpu, TransferDirection::localToHost, 4096, 10 * (100u + 4096u));
+    }
+    EXPECT_EQ(100u, planner.getObservationsCount());
+    EXPECT_NEAR(10.0, planner.getCorrection(TransferPath::cpu, TransferDirection::localToHost, 4096), 0.01);
+    EXPECT_EQ(TransferPath::copyEngine, planner.plan(TransferDirection::localToHost, 4096, allPathsMask, false).primaryPath);
+
+    // other directions and size buckets keep the prior model
+    EXPECT_EQ(1.0, planner.getCorrection(TransferPath::cpu, TransferDirection::hostToLocal, 4096));
+    EXPECT_EQ(1.0, planner.getCorrection(TransferPath::cpu, TransferDirection::localToHost, 64 * 1024));
+}
+
+TEST_F(TransferPlannerTest, givenConcurrentObservationsWhenRecordingThenNoCorrectionUpdateIsLost) {
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t observationsPerThread = 256;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back([&] {
+            for (uint32_t j = 0; j < observationsPerThread; j++) {
+                planner.recordTransfer(TransferPath::cpu, TransferDirection::localToHost, 4096, 0u);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // every observation moves the correction by the same step towards zero, so the order does not matter
+    double expectedCorrection = 1.0;
+    for (uint32_t i = 0; i < threadsCount * observationsPerThread; i++) {
+        expectedCorrection += (0.0 - expectedCorrection) * TransferPlanner::correctionWeight;
+    }
+    EXPECT_EQ(threadsCount * observationsPerThread, planner.getObservationsCount());
+    EXPECT_DOUBLE_EQ(expectedCorrection, planner.getCorrection(TransferPath::cpu, TransferDirection::localToHost, 4096));
+}
+
+TEST_F(TransferPlannerTest, givenTwoEqualPathsAndLargeTransferWhenPlanningWithSplitThenTransferIsSplitInHalf) {
+    auto mask = getTransferPathMask(TransferPath::copyEngine) | getTransferPathMask(TransferPath::computeKernel);
+    size_t size = 64 * 1024 * 1024;
+
+    auto plan = planner.plan(TransferDirection::localToLocal, size, mask, true);
+    EXPECT_TRUE(plan.isSplit());
+    EXPECT_EQ(TransferPath::copyEngine, plan.primaryPath);
+    EXPECT_EQ(TransferPath::computeKernel, plan.secondaryPath);
+    EXPECT_NEAR(static_cast<double>(size / 2), static_cast<double>(plan.primarySize), 1.0);
+    EXPECT_LT(plan.estimatedNs, planner.estimateNs(TransferPath::copyEngine, TransferDirection::localToLocal, size));
+
+    auto noSplitPlan = planner.plan(TransferDirection::localToLocal, size, mask, false);
+    EXPECT_FALSE(noSplitPlan.isSplit());
+}
+
+TEST_F(TransferPlannerTest, givenUnequalPathsWhenPlanningWithSplitThenFasterPathGetsLargerPart) {
+    TransferPlanner fasterCpuPlanner{std::make_unique<SyntheticTransferCostModel>(5.0)};
+    auto mask = getTransferPathMask(TransferPath::cpu) | getTransferPathMask(TransferPath::copyEngine);
+    size_t size = 16 * 1024 * 1024;
+
+    auto plan = fasterCpuPlanner.plan(TransferDirection::hostToLocal, size, mask, true);
+    ASSERT_TRUE(plan.isSplit());
+    EXPECT_EQ(TransferPath::cpu, plan.primaryPath);
+    EXPECT_EQ(TransferPath::copyEngine, plan.secondaryPath);
+    EXPECT_LT(plan.primarySize, size / 2);
+    EXPECT_GE(plan.primarySize, TransferPlanner::minSplitSize);
+}
+
+TEST_F(TransferPlannerTest, givenSplitGainBelowThresholdWhenPlanningWithSplitThenSinglePathIsUsed) {
+    auto mask = getTransferPathMask(TransferPath::cpu) | getTransferPathMask(TransferPath::copyEngine);
+    auto plan = planner.plan(TransferDirection::hostToLocal, 16 * 1024 * 1024, mask, true);
+    EXPECT_FALSE(plan.isSplit());
+    EXPECT_EQ(TransferPath::copyEngine, plan.primaryPath);
+}
+
+TEST_F(TransferPlannerTest, givenTransferTooSmallToSplitWhenPlanningWithSplitThenSinglePathIsUsed) {
+    auto mask = getTransferPathMask(TransferPath::copyEngine) | getTransferPathMask(TransferPath::computeKernel);
+    auto plan = planner.plan(TransferDirection::localToLocal, 2 * TransferPlanner::minSplitSize - 1, mask, true);
+    EXPECT_FALSE(plan.isSplit());
+}
+
+TEST_F(TransferPlannerTest, givenAlternativePathWithCloseEstimateWhenPlanningRepeatedlyThenEveryExplorationPeriodPlanUsesItAndItsCorrectionIsLearned) {
+    auto mask = getTransferPathMask(TransferPath::cpu) | getTransferPathMask(TransferPath::copyEngine);
+    size_t size = 8 * 1024;
+
+    for (uint64_t i = 0; i < TransferPlanner::explorationPeriod - 1; i++) {
+        EXPECT_EQ(TransferPath::cpu, planner.plan(TransferDirection::hostToLocal, size, mask, false).primaryPath);
+    }
+    auto explorationPlan = planner.plan(TransferDirection::hostToLocal, size, mask, false);
+    EXPECT_EQ(TransferPath::copyEngine, explorationPlan.primaryPath);
+    EXPECT_EQ(size, explorationPlan.primarySize);
+    EXPECT_FALSE(explorationPlan.isSplit());
+
+    for (int i = 0; i < 64; i++) {
+        planner.recordTransfer(TransferPath::copyEngine, TransferDirection::hostToLocal, size, explorationPlan.estimatedNs / 4);
+    }
+    EXPECT_EQ(TransferPath::copyEngine, planner.plan(TransferDirection::hostToLocal, size, mask, false).primaryPath);
+}
+
+TEST_F(TransferPlannerTest, givenAlternativePathMuchSlowerThanBestWhenPlanningRepeatedlyThenItIsNotExplored) {
+    auto mask = getTransferPathMask(TransferPath::cpu) | getTransferPathMask(TransferPath::copyEngine);
+
+    for (uint64_t i = 0; i < 2 * TransferPlanner::explorationPeriod; i++) {
+        EXPECT_EQ(TransferPath::cpu, planner.plan(TransferDirection::hostToLocal, 64, mask, false).primaryPath);
+    }
+}
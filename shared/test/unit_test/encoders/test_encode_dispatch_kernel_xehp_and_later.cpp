@@ -13,6 +13,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/simd_helper.h"
+#include "shared/source/kernel/dispatch_template_cache.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
@@ -89,6 +90,99 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenXeHpAndLaterWhenDispa
     EXPECT_EQ(INTERFACE_DESCRIPTOR_DATA::DENORM_MODE_FTZ, idd.getDenormMode());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchTemplateCacheWhenDispatchingSameKernelTwiceThenSecondDispatchRestoresInterfaceDescriptorFromTemplate) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchTemplateCache dispatchTemplateCache(4u);
+    dispatchInterface->getDispatchTemplateCacheResult = &dispatchTemplateCache;
+    dispatchInterface->getSlmTotalSizeResult = 1024u;
+    dispatchInterface->kernelDescriptor.kernelAttributes.barrierCount = 1;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchTemplateCache.getMissCount());
+    EXPECT_EQ(0u, dispatchTemplateCache.getHitCount());
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchTemplateCache.getMissCount());
+    EXPECT_EQ(1u, dispatchTemplateCache.getHitCount());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+
+    auto walkers = findAll<DefaultWalkerType *>(commands.begin(), commands.end());
+    ASSERT_EQ(2u, walkers.size());
+
+    auto firstWalker = genCmdCast<DefaultWalkerType *>(*walkers[0]);
+    auto secondWalker = genCmdCast<DefaultWalkerType *>(*walkers[1]);
+    EXPECT_EQ(0, memcmp(&firstWalker->getInterfaceDescriptor(), &secondWalker->getInterfaceDescriptor(), sizeof(firstWalker->getInterfaceDescriptor())));
+    EXPECT_NE(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchTemplateCacheWhenGroupSizeChangesBetweenDispatchesThenNewTemplateIsEncoded) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    DispatchTemplateCache dispatchTemplateCache(4u);
+    dispatchInterface->getDispatchTemplateCacheResult = &dispatchTemplateCache;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    dispatchInterface->groupSizes[0] = 16u;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+
+    EXPECT_EQ(2u, dispatchTemplateCache.getMissCount());
+    EXPECT_EQ(0u, dispatchTemplateCache.getHitCount());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenIndirectDataReuseEnabledWhenDispatchingKernelWithUnchangedArgumentsThenPreviousIndirectDataIsReused) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIndirectDataReuse.set(1);
+
+    auto container = std::make_unique<MyMockCommandContainer>();
+    container->initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
+    container->setDirtyStateForAllHeaps(false);
+    container->l1CachePolicyDataRef() = &this->l1CachePolicyData;
+    auto indirectDataCache = container->getIndirectDataCache();
+    ASSERT_NE(nullptr, indirectDataCache);
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+
+    auto heap = container->getIndirectHeap(HeapType::indirectObject);
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*container, dispatchArgs);
+    auto heapUsed = heap->getUsed();
+    EXPECT_NE(0u, indirectDataCache->getLastLaunchBytesWritten());
+
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*container, dispatchArgs);
+    EXPECT_EQ(heapUsed, heap->getUsed());
+    EXPECT_EQ(0u, indirectDataCache->getLastLaunchBytesWritten());
+    EXPECT_EQ(1u, indirectDataCache->getReusedLaunchesCount());
+
+    dispatchInterface->dataCrossThread[0]++;
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*container, dispatchArgs);
+    EXPECT_LT(heapUsed, heap->getUsed());
+    EXPECT_NE(0u, indirectDataCache->getLastLaunchBytesWritten());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, container->getCommandStream()->getCpuBase(), container->getCommandStream()->getUsed());
+    auto walkers = findAll<DefaultWalkerType *>(commands.begin(), commands.end());
+    ASSERT_EQ(3u, walkers.size());
+    auto firstWalker = genCmdCast<DefaultWalkerType *>(*walkers[0]);
+    auto secondWalker = genCmdCast<DefaultWalkerType *>(*walkers[1]);
+    auto thirdWalker = genCmdCast<DefaultWalkerType *>(*walkers[2]);
+    EXPECT_EQ(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+    EXPECT_NE(firstWalker->getIndirectDataStartAddress(), thirdWalker->getIndirectDataStartAddress());
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenXeHpDebuggingEnabledAndAssertInKernelWhenDispatchingKernelThenSwExceptionsAreEnabled) {
     using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
@@ -196,6 +290,47 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenOverrideSlmTotalSizeD
     }
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDebugFlagsAndPartitionCountWhenGettingRequiredEncodeFeaturesThenOnlyUsedFeaturesAreReturned) {
+    DebugManagerStateRestore restorer;
+
+    EXPECT_EQ(0u, EncodeDispatchKernel<FamilyType>::getRequiredEncodeFeatures(1));
+    EXPECT_EQ(EncodeDispatchKernelFeatures::implicitScaling, EncodeDispatchKernel<FamilyType>::getRequiredEncodeFeatures(2));
+
+    debugManager.flags.OverrideSlmAllocationSize.set(1);
+    EXPECT_EQ(EncodeDispatchKernelFeatures::debugFlags, EncodeDispatchKernel<FamilyType>::getRequiredEncodeFeatures(1));
+    EXPECT_EQ(EncodeDispatchKernelFeatures::all, EncodeDispatchKernel<FamilyType>::getRequiredEncodeFeatures(2));
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenSpecializedEncoderWithoutDebugFlagsFeatureWhenDispatchingKernelThenDebugFlagsAreNotChecked) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.OverrideSlmAllocationSize.set(5);
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->getSlmTotalSizeResult = 0;
+
+    auto encodeAll = EncodeDispatchKernel<FamilyType>::getSpecializedEncode(EncodeDispatchKernelFeatures::all);
+    auto encodeNoDebugFlags = EncodeDispatchKernel<FamilyType>::getSpecializedEncode(EncodeDispatchKernelFeatures::implicitScaling);
+    EXPECT_EQ((&EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>), encodeAll);
+    EXPECT_NE(encodeAll, encodeNoDebugFlags);
+
+    for (auto encode : {encodeAll, encodeNoDebugFlags}) {
+        cmdContainer->reset();
+
+        EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+        encode(*cmdContainer.get(), dispatchArgs);
+
+        GenCmdList commands;
+        CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+        auto itor = find<DefaultWalkerType *>(commands.begin(), commands.end());
+        ASSERT_NE(itor, commands.end());
+        auto &idd = genCmdCast<DefaultWalkerType *>(*itor)->getInterfaceDescriptor();
+
+        EXPECT_EQ(encode == encodeAll, 5u == idd.getSharedLocalMemorySize());
+    }
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenStatelessBufferAndImageWhenDispatchingKernelThenBindingTableOffsetIsCorrect) {
     using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
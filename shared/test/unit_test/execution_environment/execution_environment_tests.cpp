@@ -18,6 +18,7 @@
 #include "shared/source/helpers/driver_model_type.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/memcpy_engine.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/os_interface.h"
@@ -241,6 +242,16 @@ TEST(ExecutionEnvironment, givenEnableDirectSubmissionControllerSetZeroWhenIniti
     EXPECT_EQ(controller, nullptr);
 }
 
+TEST(ExecutionEnvironment, givenExecutionEnvironmentWhenGettingMemcpyThreadPoolThenPoolIsCreatedOnceWithoutWorkers) {
+    MockExecutionEnvironment executionEnvironment{};
+    EXPECT_EQ(nullptr, executionEnvironment.memcpyThreadPool);
+
+    auto threadPool = executionEnvironment.getMemcpyThreadPool();
+    ASSERT_NE(nullptr, threadPool);
+    EXPECT_EQ(threadPool, executionEnvironment.getMemcpyThreadPool());
+    EXPECT_EQ(0u, threadPool->getWorkersCount());
+}
+
 TEST(ExecutionEnvironment, givenNeoCalEnabledWhenCreateExecutionEnvironmentThenSetDebugVariables) {
     const std::unordered_map<std::string, int32_t> config = {
         {"UseKmdMigration", 0},
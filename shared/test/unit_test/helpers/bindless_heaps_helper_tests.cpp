@@ -16,6 +16,8 @@
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/unit_test/fixtures/front_window_fixture.h"
 
+#include <thread>
+
 using namespace NEO;
 
 TEST(BindlessHeapsHelper, givenExternalAllocatorFlagAndBindlessModeEnabledWhenCreatingRootDevicesThenBindlessHeapsHelperCreated) {
@@ -184,6 +186,36 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenAllocatingMoreSsThen
     EXPECT_NE(ssAllocationBefore, ssAllocationAfter);
 }
 
+TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenGlobalSshIsExhaustedThenHeapGrowCountIsIncremented) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getMemoryManager(), false, rootDeviceIndex, devBitfield);
+    size_t ssSize = 0x40;
+    auto ssCount = bindlessHeapHelper->globalSsh->getAvailableSpace() / ssSize;
+    auto graphicsAllocations = std::make_unique<MockGraphicsAllocation[]>(ssCount);
+    for (uint32_t i = 0; i < ssCount; i++) {
+        bindlessHeapHelper->allocateSSInHeap(ssSize, &graphicsAllocations[i], BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    }
+    EXPECT_EQ(0u, bindlessHeapHelper->getHeapGrowCount());
+
+    MockGraphicsAllocation alloc;
+    bindlessHeapHelper->allocateSSInHeap(ssSize, &alloc, BindlessHeapsHelper::BindlesHeapType::globalSsh);
+    EXPECT_EQ(1u, bindlessHeapHelper->getHeapGrowCount());
+    EXPECT_EQ(0u, bindlessHeapHelper->getReusedSlotsCount());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenSurfaceStateReuseLockObtainedWhenOtherThreadTriesToObtainItThenItIsNotAcquiredUntilReleased) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getMemoryManager(), false, rootDeviceIndex, devBitfield);
+
+    auto surfaceStateReuseLock = bindlessHeapHelper->obtainSurfaceStateReuseLock();
+    EXPECT_TRUE(surfaceStateReuseLock.owns_lock());
+    std::thread([&]() { EXPECT_FALSE(bindlessHeapHelper->surfaceStateReuseMtx.try_lock()); }).join();
+
+    surfaceStateReuseLock.unlock();
+    std::thread([&]() {
+        EXPECT_TRUE(bindlessHeapHelper->surfaceStateReuseMtx.try_lock());
+        bindlessHeapHelper->surfaceStateReuseMtx.unlock();
+    }).join();
+}
+
 TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenCreatedThenAllocationsHaveTheSameBaseAddress) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getMemoryManager(), false, rootDeviceIndex, devBitfield);
     for (auto allocation : bindlessHeapHelper->ssHeapsAllocations) {
@@ -351,6 +383,7 @@ TEST_F(BindlessHeapsHelperTests, givenFreeSlotsExceedingThresholdInResuePoolWhen
 
     ssInHeapInfos[4] = bindlessHeapHelper->allocateSSInHeap(size, nullptr, BindlessHeapsHelper::BindlesHeapType::globalSsh);
     EXPECT_TRUE(bindlessHeapHelper->allocateFromReusePool);
+    EXPECT_EQ(1u, bindlessHeapHelper->getReusedSlotsCount());
 
     EXPECT_EQ(0u, bindlessHeapHelper->allocatePoolIndex);
     EXPECT_EQ(1u, bindlessHeapHelper->releasePoolIndex);
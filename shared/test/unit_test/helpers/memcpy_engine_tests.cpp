@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/memcpy_engine.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+void fillPattern(std::vector<uint8_t> &buffer) {
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+}
+
+class MockMemcpyThreadPool : public MemcpyThreadPool {
+  public:
+    std::thread startWorker() override {
+        if (startWorkerCalled++ >= allowedWorkerStarts) {
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again));
+        }
+        return MemcpyThreadPool::startWorker();
+    }
+
+    uint32_t allowedWorkerStarts = std::numeric_limits<uint32_t>::max();
+    uint32_t startWorkerCalled = 0;
+};
+} // namespace
+
+TEST(MemcpyEngineTest, givenSmallCopyWhenGettingCopyFunctionThenCacheableCopyIsUsedForEveryHint) {
+    for (auto hint : {MemcpyHint::cacheable, MemcpyHint::writeCombinedDestination, MemcpyHint::uncachedSource}) {
+        EXPECT_EQ(&MemcpyEngine::copyCacheable, MemcpyEngine::getCopyFunction(hint, MemcpyEngine::minStreamingCopySize - 1));
+    }
+}
+
+TEST(MemcpyEngineTest, givenLargeCopyWhenGettingCopyFunctionThenFunctionMatchingHintIsUsed) {
+    auto size = MemcpyEngine::minStreamingCopySize;
+    EXPECT_EQ(&MemcpyEngine::copyCacheable, MemcpyEngine::getCopyFunction(MemcpyHint::cacheable, size));
+    EXPECT_EQ(MemcpyEngine::copyWithStreamingStores, MemcpyEngine::getCopyFunction(MemcpyHint::writeCombinedDestination, size));
+    EXPECT_EQ(MemcpyEngine::copyWithStreamingLoads, MemcpyEngine::getCopyFunction(MemcpyHint::uncachedSource, size));
+}
+
+TEST(MemcpyEngineTest, givenCopySizeWhenGettingThreadsCountThenThresholdAndThreadLimitAreRespected) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(1u, MemcpyEngine::getCopyThreadsCount(MemcpyEngine::defaultParallelCopyThreshold - 1));
+    EXPECT_LE(1u, MemcpyEngine::getCopyThreadsCount(MemcpyEngine::defaultParallelCopyThreshold));
+    EXPECT_GE(MemcpyEngine::defaultMaxCopyThreads, MemcpyEngine::getCopyThreadsCount(64 * MemoryConstants::gigaByte));
+
+    debugManager.flags.CpuCopyParallelThreshold.set(0);
+    EXPECT_EQ(1u, MemcpyEngine::getCopyThreadsCount(64 * MemoryConstants::gigaByte));
+
+    debugManager.flags.CpuCopyParallelThreshold.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    debugManager.flags.CpuCopyMaxThreads.set(1);
+    EXPECT_EQ(1u, MemcpyEngine::getCopyThreadsCount(64 * MemoryConstants::megaByte));
+}
+
+TEST(MemcpyEngineTest, givenUnalignedPointersAndSizesWhenCopyingWithAnyHintThenDataIsCopied) {
+    constexpr size_t maxSize = 64 * MemoryConstants::kiloByte + 77;
+    std::vector<uint8_t> src(maxSize + 64);
+    fillPattern(src);
+
+    for (auto hint : {MemcpyHint::cacheable, MemcpyHint::writeCombinedDestination, MemcpyHint::uncachedSource}) {
+        for (size_t size : {size_t(0), size_t(1), size_t(31), size_t(33), MemcpyEngine::minStreamingCopySize - 1, MemcpyEngine::minStreamingCopySize, MemcpyEngine::minStreamingCopySize + 13, maxSize}) {
+            for (size_t srcOffset : {0, 1, 31}) {
+                for (size_t dstOffset : {0, 5, 32}) {
+                    std::vector<uint8_t> dst(maxSize + 64, 0);
+                    MemcpyEngine::copy(dst.data() + dstOffset, src.data() + srcOffset, size, hint, nullptr);
+                    EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + srcOffset, size));
+                    EXPECT_EQ(0u, dst[dstOffset + size]);
+                }
+            }
+        }
+    }
+}
+
+TEST(MemcpyEngineTest, givenCopyAboveParallelThresholdWhenCopyingWithThreadPoolThenDataIsCopiedAndWorkersAreReused) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuCopyParallelThreshold.set(static_cast<int32_t>(64 * MemoryConstants::kiloByte));
+    debugManager.flags.CpuCopyMaxThreads.set(4);
+
+    constexpr size_t size = MemoryConstants::megaByte + 123;
+    std::vector<uint8_t> src(size);
+    fillPattern(src);
+
+    MockMemcpyThreadPool threadPool;
+    EXPECT_EQ(0u, threadPool.getWorkersCount());
+    auto expectedWorkersCount = MemcpyEngine::getCopyThreadsCount(size) - 1;
+
+    for (auto hint : {MemcpyHint::cacheable, MemcpyHint::writeCombinedDestination, MemcpyHint::uncachedSource}) {
+        std::vector<uint8_t> dst(size, 0);
+        MemcpyEngine::copy(dst.data(), src.data(), size, hint, &threadPool);
+        EXPECT_EQ(src, dst);
+        EXPECT_EQ(expectedWorkersCount, threadPool.getWorkersCount());
+    }
+    EXPECT_EQ(expectedWorkersCount, threadPool.startWorkerCalled);
+}
+
+TEST(MemcpyEngineTest, givenWorkerThreadsCannotBeStartedWhenCopyingWithThreadPoolThenDataIsCopiedWithStartedWorkersOrOnCallingThread) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuCopyParallelThreshold.set(static_cast<int32_t>(64 * MemoryConstants::kiloByte));
+    debugManager.flags.CpuCopyMaxThreads.set(4);
+
+    constexpr size_t size = MemoryConstants::megaByte + 123;
+    std::vector<uint8_t> src(size);
+    fillPattern(src);
+
+    for (uint32_t allowedWorkerStarts : {0u, 1u}) {
+        MockMemcpyThreadPool threadPool;
+        threadPool.allowedWorkerStarts = allowedWorkerStarts;
+
+        std::vector<uint8_t> dst(size, 0);
+        MemcpyEngine::copy(dst.data(), src.data(), size, MemcpyHint::cacheable, &threadPool);
+        EXPECT_EQ(src, dst);
+        EXPECT_EQ(std::min(allowedWorkerStarts, MemcpyEngine::getCopyThreadsCount(size) - 1), threadPool.getWorkersCount());
+
+        auto startWorkerCalled = threadPool.startWorkerCalled;
+        MemcpyEngine::copy(dst.data(), src.data(), size, MemcpyHint::cacheable, &threadPool);
+        EXPECT_EQ(startWorkerCalled, threadPool.startWorkerCalled);
+    }
+}
+
+TEST(MemcpyEngineTest, givenCopiesIssuedFromSeveralThreadsWhenCopyingWithSharedThreadPoolThenAllDataIsCopied) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuCopyParallelThreshold.set(static_cast<int32_t>(64 * MemoryConstants::kiloByte));
+    debugManager.flags.CpuCopyMaxThreads.set(4);
+
+    constexpr size_t size = 256 * MemoryConstants::kiloByte + 5;
+    constexpr uint32_t numCallers = 4;
+    std::vector<uint8_t> src(size);
+    fillPattern(src);
+    std::vector<std::vector<uint8_t>> dst(numCallers, std::vector<uint8_t>(size, 0));
+
+    MemcpyThreadPool threadPool;
+    std::vector<std::thread> callers;
+    for (uint32_t i = 0; i < numCallers; i++) {
+        callers.emplace_back([&, i]() {
+            for (uint32_t repeat = 0; repeat < 8; repeat++) {
+                MemcpyEngine::copy(dst[i].data(), src.data(), size, MemcpyHint::cacheable, &threadPool);
+            }
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+
+    for (auto &callerDst : dst) {
+        EXPECT_EQ(src, callerDst);
+    }
+}
+
+// Bandwidth of single-threaded and pooled copies for each hint, in bytes per microsecond.
+// Real write-combined mappings need a device; the streaming store path is run on host memory whose
+// cachelines are never read back, which is the access pattern of an upload to a BAR mapping.
+TEST(MemcpyEngineBenchmark, givenCacheableWriteCombinedAndUncachedCopiesWhenCopyingThenBandwidthIsRecorded) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.CpuCopyParallelThreshold.set(static_cast<int32_t>(4 * MemoryConstants::megaByte));
+
+    constexpr size_t size = 16 * MemoryConstants::megaByte;
+    std::vector<uint8_t> src(size);
+    std::vector<uint8_t> dst(size);
+    fillPattern(src);
+    MemcpyThreadPool threadPool;
+
+    struct {
+        const char *name;
+        MemcpyHint hint;
+    } benchmarkCases[] = {{"cacheable", MemcpyHint::cacheable},
+                          {"writeCombinedDestination", MemcpyHint::writeCombinedDestination},
+                          {"uncachedSource", MemcpyHint::uncachedSource}};
+
+    for (auto &benchmarkCase : benchmarkCases) {
+        for (auto pool : {static_cast<MemcpyThreadPool *>(nullptr), &threadPool}) {
+            auto start = std::chrono::steady_clock::now();
+            MemcpyEngine::copy(dst.data(), src.data(), size, benchmarkCase.hint, pool);
+            auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            RecordProperty(std::string(benchmarkCase.name) + (pool ? "_pooled" : "_singleThread") + "_16MB", static_cast<int>(size / std::max<int64_t>(elapsedUs, 1)));
+        }
+    }
+}
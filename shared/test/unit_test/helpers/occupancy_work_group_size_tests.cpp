@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/kernel_helpers.h"
+#include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/occupancy_work_group_size.h"
+#include "shared/source/kernel/grf_config.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+using namespace NEO;
+
+struct OccupancyWorkGroupSizeTests : ::testing::Test {
+    void SetUp() override {
+        occupancyInfo.simdSize = 32;
+        occupancyInfo.maxWorkGroupSize = 1024;
+        occupancyInfo.dssCount = 32;
+        occupancyInfo.availableThreadCount = 32 * 64;
+        occupancyInfo.slmSizePerDss = 128 * MemoryConstants::kiloByte;
+        occupancyInfo.maxBarrierCount = 32;
+    }
+
+    OccupancyInfo occupancyInfo;
+};
+
+TEST_F(OccupancyWorkGroupSizeTests, givenSlmAndBarrierUsageWhenEstimatingOccupancyThenResidentWorkGroupsAreLimitedPerDss) {
+    size_t workGroupSize[3] = {64, 1, 1};
+    size_t workItems[3] = {1024 * 1024, 1, 1};
+    OccupancyEstimate estimate;
+
+    EXPECT_TRUE(estimateOccupancy(occupancyInfo, workGroupSize, workItems, estimate));
+    EXPECT_EQ(2u, estimate.threadsPerWorkGroup);
+    EXPECT_EQ(32u * 32u, estimate.maxResidentWorkGroups);
+    EXPECT_EQ(32u * 32u * 2u, estimate.residentThreads);
+    EXPECT_EQ(0u, estimate.idleLanes);
+
+    occupancyInfo.usedSlmSize = 32 * MemoryConstants::kiloByte;
+    EXPECT_TRUE(estimateOccupancy(occupancyInfo, workGroupSize, workItems, estimate));
+    EXPECT_EQ(4u * 32u, estimate.maxResidentWorkGroups);
+    EXPECT_EQ(4u * 32u * 2u, estimate.residentThreads);
+
+    occupancyInfo.barriersCount = 16;
+    EXPECT_TRUE(estimateOccupancy(occupancyInfo, workGroupSize, workItems, estimate));
+    EXPECT_EQ(2u * 32u, estimate.maxResidentWorkGroups);
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenSlmUsageWhenSuggestingWorkGroupSizeThenLargerGroupsAreChosenToKeepSubslicesBusy) {
+    size_t workItems[3] = {1024 * 1024, 1, 1};
+    size_t workGroupSize[3] = {};
+
+    occupancyInfo.usedSlmSize = 64 * MemoryConstants::kiloByte;
+    EXPECT_TRUE(suggestOccupancyWorkGroupSize(occupancyInfo, workItems, 1, workGroupSize));
+    EXPECT_EQ(1024u, workGroupSize[0]);
+    EXPECT_EQ(1u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenSmallGlobalSizeWhenSuggestingWorkGroupSizeThenGroupsFillSimdLanesAndSpreadAcrossSubslices) {
+    size_t workItems[3] = {256, 1, 1};
+    size_t workGroupSize[3] = {};
+
+    EXPECT_TRUE(suggestOccupancyWorkGroupSize(occupancyInfo, workItems, 1, workGroupSize));
+    EXPECT_EQ(32u, workGroupSize[0]);
+    EXPECT_EQ(1u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenPrimeGlobalSizesWhenSuggestingWorkGroupSizeThenShapeWithFewestIdleLanesIsChosen) {
+    size_t workItems[3] = {17, 19, 1};
+    size_t workGroupSize[3] = {};
+
+    EXPECT_TRUE(suggestOccupancyWorkGroupSize(occupancyInfo, workItems, 2, workGroupSize));
+    EXPECT_EQ(17u, workGroupSize[0]);
+    EXPECT_EQ(19u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenSlmLargerThanAvailableWhenSuggestingWorkGroupSizeThenFalseIsReturned) {
+    size_t workItems[3] = {1024, 1, 1};
+    size_t workGroupSize[3] = {};
+
+    occupancyInfo.usedSlmSize = 2 * occupancyInfo.slmSizePerDss;
+    EXPECT_FALSE(suggestOccupancyWorkGroupSize(occupancyInfo, workItems, 1, workGroupSize));
+    EXPECT_EQ(0u, workGroupSize[0]);
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenHwInfoWhenEstimatingOccupancyThenResidentWorkGroupsMatchMaxCooperativeGroupCount) {
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    auto &hwInfo = *rootDeviceEnvironment.getMutableHardwareInfo();
+    hwInfo.gtSystemInfo.SliceCount = 2;
+    hwInfo.gtSystemInfo.SubSliceCount = 8;
+    hwInfo.gtSystemInfo.DualSubSliceCount = 0;
+    auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<GfxCoreHelper>();
+
+    KernelDescriptor kernelDescriptor;
+    kernelDescriptor.kernelAttributes.simdSize = 32;
+    kernelDescriptor.kernelAttributes.barrierCount = 1;
+    const uint32_t slmTotalSize = 4 * static_cast<uint32_t>(MemoryConstants::kiloByte);
+
+    auto info = OccupancyInfo::create(kernelDescriptor, rootDeviceEnvironment, 1024, slmTotalSize);
+    EXPECT_EQ(8u, info.dssCount);
+    EXPECT_EQ(static_cast<uint32_t>(gfxCoreHelper.getMaxBarrierRegisterPerSlice()), info.maxBarrierCount);
+    EXPECT_EQ(gfxCoreHelper.calculateAvailableThreadCount(hwInfo, kernelDescriptor.kernelAttributes.numGrfRequired), info.availableThreadCount);
+    EXPECT_EQ(gfxCoreHelper.alignSlmSize(slmTotalSize), info.usedSlmSize);
+
+    for (size_t localSize : {32u, 64u, 256u, 1024u}) {
+        const size_t workGroupSize[3] = {localSize, 1, 1};
+        const size_t workItems[3] = {1024 * 1024, 1, 1};
+        OccupancyEstimate estimate;
+        ASSERT_TRUE(estimateOccupancy(info, workGroupSize, workItems, estimate));
+
+        auto maxCooperativeGroupCount = KernelHelper::getMaxWorkGroupCount(32u, info.availableThreadCount, 8u,
+                                                                           static_cast<uint32_t>(8u * MemoryConstants::kiloByte * hwInfo.capabilityTable.slmSize),
+                                                                           gfxCoreHelper.alignSlmSize(slmTotalSize), info.maxBarrierCount, 1u, 3, workGroupSize);
+        EXPECT_EQ(maxCooperativeGroupCount, estimate.maxResidentWorkGroups);
+    }
+}
+
+TEST_F(OccupancyWorkGroupSizeTests, givenMoreBarriersThanAvailableWhenSuggestingWorkGroupSizeThenFalseIsReturned) {
+    size_t workItems[3] = {1024, 1, 1};
+    size_t workGroupSize[3] = {};
+
+    occupancyInfo.barriersCount = occupancyInfo.maxBarrierCount + 1;
+    EXPECT_FALSE(suggestOccupancyWorkGroupSize(occupancyInfo, workItems, 1, workGroupSize));
+    EXPECT_EQ(0u, workGroupSize[0]);
+}
+
+HWTEST_F(OccupancyWorkGroupSizeTests, givenProductConfigWhenSuggestingWorkGroupSizeThenResultDividesGlobalSizeAndKeepsAtLeastAsManyWorkItemsResidentAsLegacyAlgorithm) {
+    MockExecutionEnvironment mockExecutionEnvironment{};
+    auto &rootDeviceEnvironment = *mockExecutionEnvironment.rootDeviceEnvironments[0];
+    constexpr uint32_t maxWorkGroupSize = 1024;
+
+    for (uint8_t simd : {16, 32}) {
+        for (uint32_t numGrf : {GrfConfig::defaultGrfNumber, GrfConfig::largeGrfNumber}) {
+            for (uint32_t slmSize : {0u, 16 * static_cast<uint32_t>(MemoryConstants::kiloByte)}) {
+                KernelDescriptor kernelDescriptor;
+                kernelDescriptor.kernelAttributes.simdSize = simd;
+                kernelDescriptor.kernelAttributes.numGrfRequired = numGrf;
+                kernelDescriptor.kernelAttributes.barrierCount = 1;
+
+                auto info = OccupancyInfo::create(kernelDescriptor, rootDeviceEnvironment, maxWorkGroupSize, slmSize);
+                if (slmSize > info.slmSizePerDss) {
+                    continue;
+                }
+
+                for (size_t globalX : {1u, 7u, 64u, 100u, 256u, 1000u, 4096u, 65536u}) {
+                    for (size_t globalY : {1u, 3u, 64u, 1080u}) {
+                        size_t workItems[3] = {globalX, globalY, 1};
+                        uint32_t workDim = globalY > 1 ? 2 : 1;
+
+                        size_t suggested[3] = {};
+                        ASSERT_TRUE(suggestOccupancyWorkGroupSize(info, workItems, workDim, suggested));
+                        EXPECT_LE(suggested[0] * suggested[1] * suggested[2], maxWorkGroupSize);
+                        EXPECT_EQ(0u, workItems[0] % suggested[0]);
+                        EXPECT_EQ(0u, workItems[1] % suggested[1]);
+
+                        size_t legacy[3] = {};
+                        if (workDim == 1) {
+                            computeWorkgroupSize1D(maxWorkGroupSize, legacy, workItems, simd);
+                        } else {
+                            computeWorkgroupSize2D(maxWorkGroupSize, legacy, workItems, simd);
+                        }
+
+                        OccupancyEstimate suggestedEstimate;
+                        OccupancyEstimate legacyEstimate;
+                        ASSERT_TRUE(estimateOccupancy(info, suggested, workItems, suggestedEstimate));
+                        if (estimateOccupancy(info, legacy, workItems, legacyEstimate)) {
+                            EXPECT_GE(suggestedEstimate.residentWorkItems, legacyEstimate.residentWorkItems);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -19,7 +19,10 @@
 #include "shared/test/common/mocks/mock_timestamp_packet.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -96,6 +99,56 @@ HWTEST_F(TimestampPacketTests, givenTagNodeWithPacketsUsed2WhenSemaphoreIsProgra
     }
 }
 
+TEST(TimestampPacketHelperTest, givenTicksWhenConvertingToNsThenEachValueIsScaledByResolution) {
+    uint64_t values[] = {0u, 1u, 3u, 1000u, 123456789u, 1ull << 40};
+    constexpr size_t count = sizeof(values) / sizeof(values[0]);
+    uint64_t expected[count];
+    const double resolution = 83.333;
+    for (size_t i = 0; i < count; i++) {
+        expected[i] = static_cast<uint64_t>(values[i] * resolution);
+    }
+
+    TimestampPacketHelper::convertTicksToNs(values, count / 2, resolution, 64u);
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_EQ(expected[i], values[i]);
+    }
+
+    TimestampPacketHelper::convertTicksToNs(nullptr, 0, resolution, 64u);
+}
+
+TEST(TimestampPacketHelperTest, givenTicksAboveValidBitsOrWrappedEndWhenConvertingToNsThenTicksAreMaskedAndEndIsMovedPastStart) {
+    constexpr uint32_t validBits = 32u;
+    constexpr uint64_t period = 1ull << validBits;
+    const double resolution = 2.0;
+    uint64_t values[] = {
+        (7ull << validBits) | 100u, (7ull << validBits) | 300u, // garbage above valid bits
+        period - 50u, 25u,                                      // end wrapped past the counter width
+        500u, 500u};
+
+    TimestampPacketHelper::convertTicksToNs(values, 3, resolution, validBits);
+    EXPECT_EQ(200u, values[0]);
+    EXPECT_EQ(600u, values[1]);
+    EXPECT_EQ(static_cast<uint64_t>((period - 50u) * resolution), values[2]);
+    EXPECT_EQ(static_cast<uint64_t>((period + 25u) * resolution), values[3]);
+    EXPECT_EQ(150u, values[3] - values[2]);
+    EXPECT_EQ(1000u, values[4]);
+    EXPECT_EQ(1000u, values[5]);
+}
+
+TEST(TimestampPacketHelperBenchmark, givenManyTimestampPairsWhenConvertingToNsThenConversionRateIsRecorded) {
+    constexpr size_t pairsCount = 100000;
+    std::vector<uint64_t> values(2 * pairsCount);
+    for (size_t i = 0; i < pairsCount; i++) {
+        values[2 * i] = i * 1000u;
+        values[2 * i + 1] = i * 1000u + 500u;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    TimestampPacketHelper::convertTicksToNs(values.data(), pairsCount, 83.333, 32u);
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    RecordProperty("pairsPerUs", static_cast<int>(pairsCount * 1000 / std::max<int64_t>(elapsedNs, 1)));
+}
+
 TEST_F(TimestampPacketTests, givenTagNodeWhatAskingForGpuAddressesThenReturnCorrectValue) {
     TimestampPackets<uint32_t, TimestampPacketConstants::preferredPacketCount> tag;
     MockTagNode mockNode;
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+using namespace NEO;
+
+namespace NEO {
+struct uint16x8_t;
+struct uint16x16_t;
+} // namespace NEO
+
+namespace {
+// work group sizes around SIMD and power of 2 boundaries, products are limited to 1024 by the callers
+const std::vector<uint16_t> sampledDimensionSizes = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129, 255, 256, 511, 512, 1023, 1024};
+const std::array<std::array<uint8_t, 3>, 6> dimensionsOrders = {{{{0, 1, 2}}, {{0, 2, 1}}, {{1, 0, 2}}, {{1, 2, 0}}, {{2, 0, 1}}, {{2, 1, 0}}}};
+
+bool isAvx512Testable() {
+    return generateLocalIDsSimd32Avx512 != nullptr && CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX512Bw);
+}
+} // namespace
+
+struct LocalIdGenSimd32Test : ::testing::Test {
+    void SetUp() override {
+        referenceBuffer = reinterpret_cast<uint16_t *>(alignedMalloc(bufferSize, 64));
+        testedBuffer = reinterpret_cast<uint16_t *>(alignedMalloc(bufferSize, 64));
+    }
+
+    void TearDown() override {
+        alignedFree(referenceBuffer);
+        alignedFree(testedBuffer);
+    }
+
+    bool generateAndCompare(LocalIDHelper::GenerateFunctionT generate, const std::array<uint16_t, 3> &localWorkgroupSize, uint16_t threadsPerWorkGroup,
+                            const std::array<uint8_t, 3> &dimensionsOrder, size_t size) {
+        memset(testedBuffer, 0xff, size);
+        generate(testedBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, false);
+        return memcmp(referenceBuffer, testedBuffer, size) == 0;
+    }
+
+    static constexpr uint32_t simd = 32;
+    static constexpr uint32_t maxWorkgroupSize = 1024;
+    // large enough for SIMD1 with 64 byte GRFs, one GRF per work item
+    static constexpr size_t bufferSize = maxWorkgroupSize * 64;
+    uint16_t *referenceBuffer = nullptr;
+    uint16_t *testedBuffer = nullptr;
+};
+
+TEST_F(LocalIdGenSimd32Test, givenSampledWorkgroupSizesAndDimensionsOrdersWhenGeneratingSimd32LocalIdsThenVectorGeneratorsMatchSse4GeneratorAndLinearOrder) {
+    const bool testAvx2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    const bool testAvx512 = isAvx512Testable();
+
+    for (auto &dimensionsOrder : dimensionsOrders) {
+        for (uint32_t x : sampledDimensionSizes) {
+            for (uint32_t y : sampledDimensionSizes) {
+                for (uint32_t z : sampledDimensionSizes) {
+                    if (x * y * z > maxWorkgroupSize) {
+                        continue;
+                    }
+                    std::array<uint16_t, 3> localWorkgroupSize = {{static_cast<uint16_t>(x), static_cast<uint16_t>(y), static_cast<uint16_t>(z)}};
+                    const uint32_t workItems = x * y * z;
+                    auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(simd, workItems));
+                    const size_t size = threadsPerWorkGroup * 3 * simd * sizeof(uint16_t);
+
+                    memset(referenceBuffer, 0xff, size);
+                    generateLocalIDsSimd<uint16x8_t, simd>(referenceBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, false);
+
+                    const uint32_t lwsFirst = localWorkgroupSize[dimensionsOrder[0]];
+                    const uint32_t lwsSecond = localWorkgroupSize[dimensionsOrder[1]];
+                    bool linearOrderMatches = true;
+                    for (uint32_t item = 0; item < workItems; item++) {
+                        auto threadIds = referenceBuffer + (item / simd) * 3 * simd + item % simd;
+                        linearOrderMatches &= threadIds[dimensionsOrder[0] * simd] == item % lwsFirst;
+                        linearOrderMatches &= threadIds[dimensionsOrder[1] * simd] == (item / lwsFirst) % lwsSecond;
+                        linearOrderMatches &= threadIds[dimensionsOrder[2] * simd] == item / (lwsFirst * lwsSecond);
+                    }
+                    ASSERT_TRUE(linearOrderMatches) << x << "x" << y << "x" << z;
+
+                    if (testAvx2) {
+                        ASSERT_TRUE(generateAndCompare(generateLocalIDsSimd<uint16x16_t, simd>, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, size)) << x << "x" << y << "x" << z;
+                    }
+                    if (testAvx512) {
+                        ASSERT_TRUE(generateAndCompare(generateLocalIDsSimd32Avx512, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, size)) << x << "x" << y << "x" << z;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(LocalIdGenSimd32Test, givenSampledWorkgroupSizesCompatibleWithLayoutForImagesWhenGeneratingWithAvx512ThenResultMatchesScalarWalk) {
+    if (!isAvx512Testable()) {
+        GTEST_SKIP();
+    }
+    const std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    for (uint16_t simdSize : {8, 16, 32}) {
+        for (uint32_t x : sampledDimensionSizes) {
+            for (uint32_t y : sampledDimensionSizes) {
+                std::array<uint16_t, 3> localWorkgroupSize = {{static_cast<uint16_t>(x), static_cast<uint16_t>(y), 1}};
+                if (x * y > maxWorkgroupSize || !isCompatibleWithLayoutForImages(localWorkgroupSize, dimensionsOrder, simdSize)) {
+                    continue;
+                }
+                const size_t size = (x * y + simdSize - 1) / simdSize * 3 * (simdSize == 32 ? 32 : 16) * sizeof(uint16_t);
+                memset(referenceBuffer, 0xff, size);
+                memset(testedBuffer, 0xff, size);
+                generateLocalIDsWithLayoutForImages(referenceBuffer, localWorkgroupSize, simdSize);
+                generateLocalIDsWithLayoutForImagesAvx512(testedBuffer, localWorkgroupSize, simdSize);
+                ASSERT_EQ(0, memcmp(referenceBuffer, testedBuffer, size)) << "simd" << simdSize << " " << x << "x" << y;
+            }
+        }
+    }
+}
+
+TEST_F(LocalIdGenSimd32Test, givenSampledWorkgroupSizesWhenGeneratingSimd1LocalIdsWithAvx512ThenResultMatchesScalarWalk) {
+    if (!isAvx512Testable()) {
+        GTEST_SKIP();
+    }
+    for (uint32_t grfSize : {32u, 64u}) {
+        for (auto &dimensionsOrder : dimensionsOrders) {
+            for (uint32_t x : sampledDimensionSizes) {
+                for (uint32_t y : sampledDimensionSizes) {
+                    for (uint32_t z : {1u, 2u, 3u}) {
+                        const size_t size = x * y * z * grfSize;
+                        if (size > bufferSize) {
+                            continue;
+                        }
+                        std::array<uint16_t, 3> localWorkgroupSize = {{static_cast<uint16_t>(x), static_cast<uint16_t>(y), static_cast<uint16_t>(z)}};
+                        memset(referenceBuffer, 0xff, size);
+                        memset(testedBuffer, 0xff, size);
+                        generateLocalIDsForSimdOne(referenceBuffer, localWorkgroupSize, dimensionsOrder, grfSize);
+                        generateLocalIDsForSimdOneAvx512(testedBuffer, localWorkgroupSize, dimensionsOrder, grfSize);
+                        ASSERT_EQ(0, memcmp(referenceBuffer, testedBuffer, size)) << "grf" << grfSize << " " << x << "x" << y << "x" << z;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(LocalIdGenSimd32Test, givenAvx512SupportedWhenLocalIdHelperIsInitializedThenAllGeneratorsWithAvx512VariantUseIt) {
+    if (!isAvx512Testable()) {
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(generateLocalIDsSimd32Avx512, LocalIDHelper::generateSimd32);
+    EXPECT_EQ(generateLocalIDsWithLayoutForImagesAvx512, LocalIDHelper::generateWithLayoutForImages);
+    EXPECT_EQ(generateLocalIDsForSimdOneAvx512, LocalIDHelper::generateForSimdOne);
+}
+
+using LocalIdGenBenchmark = LocalIdGenSimd32Test;
+TEST_F(LocalIdGenBenchmark, givenLargeWorkgroupWhenGeneratingLocalIdsThenScalarAndVectorTimingsAreRecorded) {
+    const std::array<uint16_t, 3> localWorkgroupSize = {{32, 32, 1}};
+    const std::array<uint8_t, 3> dimensionsOrder = {{0, 1, 2}};
+    constexpr uint16_t threadsPerWorkGroup = maxWorkgroupSize / simd;
+    constexpr int iterations = 1000;
+
+    auto measure = [&](auto &&generate) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            generate();
+        }
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() / iterations);
+    };
+
+    RecordProperty("simd32Sse4Ns", measure([&] { generateLocalIDsSimd<uint16x8_t, simd>(testedBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, false); }));
+    RecordProperty("layoutForImagesScalarNs", measure([&] { generateLocalIDsWithLayoutForImages(testedBuffer, localWorkgroupSize, simd); }));
+    RecordProperty("simd1ScalarNs", measure([&] { generateLocalIDsForSimdOne(testedBuffer, localWorkgroupSize, dimensionsOrder, 32u); }));
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        RecordProperty("simd32Avx2Ns", measure([&] { generateLocalIDsSimd<uint16x16_t, simd>(testedBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, false); }));
+    }
+    if (isAvx512Testable()) {
+        RecordProperty("simd32Avx512Ns", measure([&] { generateLocalIDsSimd32Avx512(testedBuffer, localWorkgroupSize, threadsPerWorkGroup, dimensionsOrder, false); }));
+        RecordProperty("layoutForImagesAvx512Ns", measure([&] { generateLocalIDsWithLayoutForImagesAvx512(testedBuffer, localWorkgroupSize, simd); }));
+        RecordProperty("simd1Avx512Ns", measure([&] { generateLocalIDsForSimdOneAvx512(testedBuffer, localWorkgroupSize, dimensionsOrder, 32u); }));
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/kernel/dispatch_template_cache.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockDispatchTemplateCache : public DispatchTemplateCache {
+  public:
+    using DispatchTemplateCache::cache;
+    using DispatchTemplateCache::DispatchTemplateCache;
+};
+
+struct DispatchTemplateCacheFixture {
+    void setUp() {
+        templateCache = std::make_unique<MockDispatchTemplateCache>(2u);
+        key.kernelStartPointer = 0x1000;
+        key.groupSize[0] = 32u;
+        key.groupSize[1] = 1u;
+        key.groupSize[2] = 1u;
+        key.threadsPerThreadGroup = 1u;
+        for (auto i = 0u; i < templateData.size(); i++) {
+            templateData[i] = static_cast<uint8_t>(i);
+        }
+    }
+    void tearDown() {}
+
+    std::array<uint8_t, 32> templateData{};
+    DispatchTemplateCache::Key key{};
+    std::unique_ptr<MockDispatchTemplateCache> templateCache;
+};
+
+using DispatchTemplateCacheTests = Test<DispatchTemplateCacheFixture>;
+
+TEST_F(DispatchTemplateCacheTests, givenEmptyCacheWhenRestoringTemplateThenMissIsReportedAndDestinationIsNotModified) {
+    std::array<uint8_t, 32> destination{};
+    EXPECT_FALSE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    EXPECT_EQ(1u, templateCache->getMissCount());
+    EXPECT_EQ(0u, templateCache->getHitCount());
+    for (auto &byte : destination) {
+        EXPECT_EQ(0u, byte);
+    }
+}
+
+TEST_F(DispatchTemplateCacheTests, givenStoredTemplateWhenRestoringWithSameKeyThenTemplateIsCopiedToDestination) {
+    templateCache->storeTemplate(key, templateData.data(), templateData.size());
+
+    std::array<uint8_t, 32> destination{};
+    EXPECT_TRUE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    EXPECT_EQ(templateData, destination);
+    EXPECT_EQ(1u, templateCache->getHitCount());
+    EXPECT_EQ(2u, templateCache->cache[0].lastUse);
+}
+
+TEST_F(DispatchTemplateCacheTests, givenStoredTemplateWhenRestoringWithDifferentGroupSizeOrSlmThenMissIsReported) {
+    templateCache->storeTemplate(key, templateData.data(), templateData.size());
+
+    std::array<uint8_t, 32> destination{};
+    auto otherKey = key;
+    otherKey.groupSize[1] = 2u;
+    EXPECT_FALSE(templateCache->restoreTemplate(otherKey, destination.data(), destination.size()));
+
+    otherKey = key;
+    otherKey.slmTotalSize = 1024u;
+    EXPECT_FALSE(templateCache->restoreTemplate(otherKey, destination.data(), destination.size()));
+
+    otherKey = key;
+    otherKey.preemptionMode = PreemptionMode::MidThread;
+    EXPECT_FALSE(templateCache->restoreTemplate(otherKey, destination.data(), destination.size()));
+
+    EXPECT_FALSE(templateCache->restoreTemplate(key, destination.data(), destination.size() / 2));
+    EXPECT_EQ(4u, templateCache->getMissCount());
+}
+
+TEST_F(DispatchTemplateCacheTests, givenFullCacheWhenStoringNewTemplateThenLeastRecentlyUsedEntryIsReplaced) {
+    std::array<uint8_t, 32> destination{};
+    auto secondKey = key;
+    secondKey.groupSize[0] = 64u;
+    auto thirdKey = key;
+    thirdKey.groupSize[0] = 128u;
+
+    templateCache->storeTemplate(key, templateData.data(), templateData.size());
+    templateCache->storeTemplate(secondKey, templateData.data(), templateData.size());
+    EXPECT_TRUE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+
+    templateCache->storeTemplate(thirdKey, templateData.data(), templateData.size());
+
+    EXPECT_TRUE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    EXPECT_TRUE(templateCache->restoreTemplate(thirdKey, destination.data(), destination.size()));
+    EXPECT_FALSE(templateCache->restoreTemplate(secondKey, destination.data(), destination.size()));
+}
+
+TEST_F(DispatchTemplateCacheTests, givenFullCacheWhenStoringTemplatesOneAfterAnotherThenMostRecentlyStoredTemplateIsNotReplaced) {
+    std::array<uint8_t, 32> destination{};
+    auto secondKey = key;
+    secondKey.groupSize[0] = 64u;
+    auto thirdKey = key;
+    thirdKey.groupSize[0] = 128u;
+
+    templateCache->storeTemplate(key, templateData.data(), templateData.size());
+    EXPECT_TRUE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    EXPECT_TRUE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    templateCache->storeTemplate(secondKey, templateData.data(), templateData.size());
+    templateCache->storeTemplate(thirdKey, templateData.data(), templateData.size());
+
+    EXPECT_FALSE(templateCache->restoreTemplate(key, destination.data(), destination.size()));
+    EXPECT_TRUE(templateCache->restoreTemplate(secondKey, destination.data(), destination.size()));
+    EXPECT_TRUE(templateCache->restoreTemplate(thirdKey, destination.data(), destination.size()));
+}
+
+TEST_F(DispatchTemplateCacheTests, givenTemplatesRestoredAndStoredFromSeveralThreadsWhenDoneThenEveryLookupIsCountedAndRestoredDataIsComplete) {
+    constexpr uint32_t numThreads = 4;
+    constexpr uint32_t lookupsPerThread = 1000;
+    std::atomic<uint32_t> corruptedRestores = 0;
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < numThreads; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            auto threadKey = key;
+            threadKey.groupSize[0] = 32u * (threadId + 1);
+            std::array<uint8_t, 32> destination{};
+            for (uint32_t i = 0; i < lookupsPerThread; i++) {
+                if (templateCache->restoreTemplate(threadKey, destination.data(), destination.size())) {
+                    corruptedRestores += (destination != templateData) ? 1 : 0;
+                } else {
+                    templateCache->storeTemplate(threadKey, templateData.data(), templateData.size());
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, corruptedRestores);
+    EXPECT_EQ(numThreads * lookupsPerThread, templateCache->getHitCount() + templateCache->getMissCount());
+}
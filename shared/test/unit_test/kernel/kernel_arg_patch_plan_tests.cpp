@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/kernel/kernel_arg_patch_plan.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+#include <chrono>
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+void addValueArg(KernelDescriptor &kernelDescriptor, std::initializer_list<ArgDescValue::Element> elements) {
+    ArgDescriptor arg(ArgDescriptor::argTValue);
+    for (const auto &element : elements) {
+        arg.as<ArgDescValue>().elements.push_back(element);
+    }
+    kernelDescriptor.payloadMappings.explicitArgs.push_back(arg);
+}
+} // namespace
+
+TEST(KernelArgPatchPlanTest, givenKernelDescriptorWhenBuildingPlanThenValueElementsAreFlattenedPerArg) {
+    KernelDescriptor kernelDescriptor;
+    addValueArg(kernelDescriptor, {{0x10, 4, 0}});
+    kernelDescriptor.payloadMappings.explicitArgs.push_back(ArgDescriptor(ArgDescriptor::argTPointer));
+    addValueArg(kernelDescriptor, {{0x20, 4, 0}, {0x30, 4, 4}, {undefined<CrossThreadDataOffset>, 4, 8}});
+
+    KernelArgPatchPlan plan;
+    plan.build(kernelDescriptor);
+
+    EXPECT_EQ(3u, plan.getArgsCount());
+    EXPECT_EQ(3u, plan.getValuePatchesCount());
+
+    EXPECT_EQ(0u, plan.getArgPlan(0).firstPatch);
+    EXPECT_EQ(1u, plan.getArgPlan(0).patchesCount);
+    EXPECT_EQ(0u, plan.getArgPlan(1).patchesCount);
+    EXPECT_EQ(1u, plan.getArgPlan(2).firstPatch);
+    EXPECT_EQ(2u, plan.getArgPlan(2).patchesCount);
+    EXPECT_EQ(4u, plan.getArgPlan(2).maxSourceOffset);
+
+    EXPECT_TRUE(plan.isArgSizeSufficient(0, 1));
+    EXPECT_TRUE(plan.isArgSizeSufficient(1, 0));
+    EXPECT_FALSE(plan.isArgSizeSufficient(2, 4));
+    EXPECT_TRUE(plan.isArgSizeSufficient(2, 5));
+}
+
+TEST(KernelArgPatchPlanTest, givenArgValueWhenPatchingThenElementsAreCopiedAndTruncatedToArgSize) {
+    KernelDescriptor kernelDescriptor;
+    addValueArg(kernelDescriptor, {{0x0, 4, 0}, {0x8, 4, 4}, {0x10, 4, 8}});
+
+    KernelArgPatchPlan plan;
+    plan.build(kernelDescriptor);
+
+    std::array<uint8_t, 0x20> crossThreadData;
+    crossThreadData.fill(0xfe);
+    const uint32_t argValue[3] = {0x11111111, 0x22222222, 0x33333333};
+
+    plan.patchValue(0, ArrayRef<uint8_t>(crossThreadData.data(), crossThreadData.size()), 6, argValue);
+    EXPECT_EQ(0x11111111u, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x0)));
+    EXPECT_EQ(0xfefe2222u, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x8)));
+    EXPECT_EQ(0xfefefefeu, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x10)));
+
+    plan.patchValue(0, ArrayRef<uint8_t>(crossThreadData.data(), crossThreadData.size()), sizeof(argValue), nullptr);
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x0)));
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x8)));
+    EXPECT_EQ(0u, *reinterpret_cast<uint32_t *>(ptrOffset(crossThreadData.data(), 0x10)));
+}
+
+TEST(KernelArgPatchPlanTest, givenManyArgumentsKernelWhenSettingArgsThroughPlanThenResultMatchesDescriptorWalk) {
+    constexpr uint32_t argsCount = 64;
+    KernelDescriptor kernelDescriptor;
+    for (uint32_t i = 0; i < argsCount; i++) {
+        addValueArg(kernelDescriptor, {{static_cast<CrossThreadDataOffset>(i * sizeof(uint64_t)), sizeof(uint64_t), 0}});
+    }
+
+    KernelArgPatchPlan plan;
+    plan.build(kernelDescriptor);
+
+    std::array<uint8_t, argsCount * sizeof(uint64_t)> planCrossThreadData{};
+    std::array<uint8_t, argsCount * sizeof(uint64_t)> walkCrossThreadData{};
+    ArrayRef<uint8_t> planDst(planCrossThreadData.data(), planCrossThreadData.size());
+
+    for (uint32_t argIndex = 0; argIndex < argsCount; argIndex++) {
+        const uint64_t value = 0x1234567800000000ull + argIndex;
+        plan.patchValue(argIndex, planDst, sizeof(value), &value);
+        for (const auto &element : kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescValue>().elements) {
+            memcpy_s(ptrOffset(walkCrossThreadData.data(), element.offset), element.size, ptrOffset(&value, element.sourceOffset), element.size);
+        }
+    }
+
+    EXPECT_EQ(0, memcmp(planCrossThreadData.data(), walkCrossThreadData.data(), planCrossThreadData.size()));
+}
+
+TEST(KernelArgPatchPlanBenchmark, givenManyArgumentsKernelWhenSettingArgsThroughPlanAndDescriptorWalkThenSetArgCostIsRecorded) {
+    constexpr uint32_t argsCount = 64;
+    constexpr uint32_t iterations = 2000;
+    KernelDescriptor kernelDescriptor;
+    for (uint32_t i = 0; i < argsCount; i++) {
+        addValueArg(kernelDescriptor, {{static_cast<CrossThreadDataOffset>(i * sizeof(uint64_t)), sizeof(uint64_t), 0}});
+    }
+
+    KernelArgPatchPlan plan;
+    plan.build(kernelDescriptor);
+
+    std::array<uint8_t, argsCount * sizeof(uint64_t)> crossThreadData{};
+    ArrayRef<uint8_t> dst(crossThreadData.data(), crossThreadData.size());
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t iteration = 0; iteration < iterations; iteration++) {
+        for (uint32_t argIndex = 0; argIndex < argsCount; argIndex++) {
+            const uint64_t value = iteration + argIndex;
+            plan.patchValue(argIndex, dst, sizeof(value), &value);
+        }
+    }
+    auto planNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (uint64_t iteration = 0; iteration < iterations; iteration++) {
+        for (uint32_t argIndex = 0; argIndex < argsCount; argIndex++) {
+            const uint64_t value = iteration + argIndex;
+            for (const auto &element : kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescValue>().elements) {
+                memcpy_s(ptrOffset(crossThreadData.data(), element.offset), element.size, ptrOffset(&value, element.sourceOffset), element.size);
+            }
+        }
+    }
+    auto walkNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("planNsPerSetArg", static_cast<int>(planNs / (iterations * argsCount)));
+    RecordProperty("descriptorWalkNsPerSetArg", static_cast<int>(walkNs / (iterations * argsCount)));
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/kernel/local_ids_cache.h"
+#include "shared/source/kernel/shared_local_ids_cache.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+class MockSharedLocalIdsCache : public SharedLocalIdsCache {
+  public:
+    using SharedLocalIdsCache::SharedLocalIdsCache;
+    using SharedLocalIdsCache::slots;
+};
+
+struct SharedLocalIdsCacheFixture {
+    void setUp() {
+        gfxCoreHelper = GfxCoreHelper::create(defaultHwInfo->platform.eRenderCoreFamily);
+        key.groupSize = {128, 2, 1};
+        key.simdSize = 32;
+        key.grfSize = 32;
+    }
+    void tearDown() {}
+
+    size_t getSize(const SharedLocalIdsCache::Key &key) {
+        LocalIdsCache localIdsCache(1, key.wgDimOrder, key.simdSize, key.grfSize, key.usesOnlyImages);
+        return localIdsCache.getLocalIdsSizeForGroup(key.groupSize, *gfxCoreHelper);
+    }
+
+    std::unique_ptr<GfxCoreHelper> gfxCoreHelper;
+    SharedLocalIdsCache::Key key{};
+    alignas(32) std::array<uint8_t, 4096> expected{};
+    alignas(32) std::array<uint8_t, 4096> emitted{};
+};
+
+using SharedLocalIdsCacheTests = Test<SharedLocalIdsCacheFixture>;
+
+TEST_F(SharedLocalIdsCacheTests, givenDifferentLayoutsWhenPackingKeysThenKeysAreUniqueAndUnsupportedLayoutsAreNotCacheable) {
+    auto packedKey = SharedLocalIdsCache::packKey(key);
+    EXPECT_NE(0u, packedKey);
+
+    auto otherKey = key;
+    otherKey.wgDimOrder = {1, 0, 2};
+    EXPECT_NE(packedKey, SharedLocalIdsCache::packKey(otherKey));
+    otherKey = key;
+    otherKey.usesOnlyImages = true;
+    EXPECT_NE(packedKey, SharedLocalIdsCache::packKey(otherKey));
+    otherKey = key;
+    otherKey.simdSize = 16;
+    EXPECT_NE(packedKey, SharedLocalIdsCache::packKey(otherKey));
+
+    otherKey = key;
+    otherKey.groupSize = {4096, 1, 1};
+    EXPECT_EQ(0u, SharedLocalIdsCache::packKey(otherKey));
+}
+
+TEST_F(SharedLocalIdsCacheTests, givenSameLayoutEmittedTwiceWhenEmittingLocalIdsThenSecondEmitIsServedFromCacheWithIdenticalData) {
+    MockSharedLocalIdsCache cache(SharedLocalIdsCache::defaultBudget);
+    auto size = getSize(key);
+    ASSERT_LE(size, expected.size());
+    generateLocalIDs(expected.data(), key.simdSize, {key.groupSize[0], key.groupSize[1], key.groupSize[2]}, key.wgDimOrder, key.usesOnlyImages, key.grfSize, *gfxCoreHelper);
+
+    cache.emitLocalIds(key, emitted.data(), size, *gfxCoreHelper);
+    EXPECT_EQ(0, memcmp(expected.data(), emitted.data(), size));
+    EXPECT_EQ(1u, cache.getMissCount());
+    EXPECT_EQ(size, cache.getCachedBytes());
+
+    emitted.fill(0);
+    cache.emitLocalIds(key, emitted.data(), size, *gfxCoreHelper);
+    EXPECT_EQ(0, memcmp(expected.data(), emitted.data(), size));
+    EXPECT_EQ(1u, cache.getHitCount());
+    EXPECT_EQ(1u, cache.getMissCount());
+}
+
+TEST_F(SharedLocalIdsCacheTests, givenBudgetExceededWhenInsertingNewLayoutThenLeastRecentlyUsedEntriesAreEvicted) {
+    auto size = getSize(key);
+    MockSharedLocalIdsCache cache(2 * size);
+
+    for (uint16_t groupSizeY = 1; groupSizeY <= 4; groupSizeY++) {
+        auto currentKey = key;
+        currentKey.groupSize = {128, groupSizeY, 1};
+        auto currentSize = getSize(currentKey);
+        if (currentSize > emitted.size()) {
+            continue;
+        }
+        cache.emitLocalIds(currentKey, emitted.data(), currentSize, *gfxCoreHelper);
+        EXPECT_LE(cache.getCachedBytes(), 2 * size);
+    }
+
+    size_t entriesCount = 0;
+    for (auto &slot : cache.slots) {
+        entriesCount += slot.entry.load() ? 1 : 0;
+    }
+    EXPECT_GE(2u, entriesCount);
+    EXPECT_LT(0u, entriesCount);
+}
+
+TEST_F(SharedLocalIdsCacheTests, givenLocalIdsCacheWithSharedCacheWhenSettingLocalIdsThenKernelCacheIsBypassedAndSharedCacheIsUsed) {
+    MockSharedLocalIdsCache sharedCache(SharedLocalIdsCache::defaultBudget);
+    LocalIdsCache firstKernelCache(4, key.wgDimOrder, key.simdSize, key.grfSize, key.usesOnlyImages);
+    LocalIdsCache secondKernelCache(4, key.wgDimOrder, key.simdSize, key.grfSize, key.usesOnlyImages);
+    firstKernelCache.setSharedCache(&sharedCache);
+    secondKernelCache.setSharedCache(&sharedCache);
+
+    firstKernelCache.setLocalIdsForGroup(key.groupSize, expected.data(), *gfxCoreHelper);
+    secondKernelCache.setLocalIdsForGroup(key.groupSize, emitted.data(), *gfxCoreHelper);
+
+    EXPECT_EQ(1u, sharedCache.getMissCount());
+    EXPECT_EQ(1u, sharedCache.getHitCount());
+    EXPECT_EQ(0, memcmp(expected.data(), emitted.data(), firstKernelCache.getLocalIdsSizeForGroup(key.groupSize, *gfxCoreHelper)));
+}
+
+TEST_F(SharedLocalIdsCacheTests, givenConcurrentEmittersWhenLayoutsAreEvictedAndInsertedThenEmittedDataIsAlwaysCorrect) {
+    constexpr uint32_t layoutsCount = 8;
+    struct alignas(32) Reference {
+        std::array<uint8_t, 4096> data;
+        size_t size;
+    };
+    std::vector<SharedLocalIdsCache::Key> keys;
+    std::vector<Reference> references(layoutsCount);
+    for (uint16_t i = 0; i < layoutsCount; i++) {
+        auto currentKey = key;
+        currentKey.groupSize = {static_cast<uint16_t>(8 * (i + 1)), 4, 1};
+        keys.push_back(currentKey);
+        references[i].size = getSize(currentKey);
+        ASSERT_LE(references[i].size, references[i].data.size());
+        generateLocalIDs(references[i].data.data(), currentKey.simdSize, {currentKey.groupSize[0], currentKey.groupSize[1], currentKey.groupSize[2]},
+                         currentKey.wgDimOrder, currentKey.usesOnlyImages, currentKey.grfSize, *gfxCoreHelper);
+    }
+
+    MockSharedLocalIdsCache cache(references[layoutsCount - 1].size * 2);
+    std::atomic<uint32_t> mismatches{0};
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < 4; threadId++) {
+        threads.emplace_back([&, threadId]() {
+            std::array<uint8_t, 4096> destination{};
+            for (uint32_t iteration = 0; iteration < 200; iteration++) {
+                auto layout = (iteration + threadId) % layoutsCount;
+                cache.emitLocalIds(keys[layout], destination.data(), references[layout].size, *gfxCoreHelper);
+                if (memcmp(destination.data(), references[layout].data.data(), references[layout].size) != 0) {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, mismatches.load());
+    EXPECT_EQ(800u, cache.getHitCount() + cache.getMissCount());
+    EXPECT_LE(cache.getCachedBytes(), references[layoutsCount - 1].size * 2);
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/host_ptr_import_cache.h"
+#include "shared/source/os_interface/os_context.h"
+#include "shared/test/common/fixtures/memory_allocator_fixture.h"
+#include "shared/test/common/helpers/engine_descriptor_helper.h"
+#include "shared/test/common/mocks/mock_allocation_properties.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct HostPtrImportCacheTest : public MemoryAllocatorFixture,
+                                public ::testing::Test {
+    void SetUp() override {
+        MemoryAllocatorFixture::setUp();
+        hostMemory = std::make_unique<uint8_t[]>(hostMemorySize + MemoryConstants::pageSize);
+        hostPtr = alignUp(hostMemory.get(), MemoryConstants::pageSize);
+        for (auto &queueCsr : queueCsrs) {
+            queueCsr = std::make_unique<MockCommandStreamReceiver>(*executionEnvironment, 0, 1);
+            auto osContext = memoryManager->createAndRegisterOsContext(queueCsr.get(), EngineDescriptorHelper::getDefaultDescriptor({aub_stream::EngineType::ENGINE_RCS, EngineUsage::regular}));
+            queueCsr->setupContext(*osContext);
+        }
+    }
+
+    void TearDown() override {
+        for (auto &queueCsr : queueCsrs) {
+            queueCsr.reset();
+        }
+        MemoryAllocatorFixture::tearDown();
+    }
+
+    GraphicsAllocation *importHostPtr(size_t offset, size_t size) {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, size, AllocationType::externalHostPtr}, ptrOffset(hostPtr, offset));
+        EXPECT_NE(nullptr, allocation);
+        return allocation;
+    }
+
+    // residency of a flushed submission: assigns the task count and consumes one pending assignment
+    void submit(MockCommandStreamReceiver &queueCsr, std::initializer_list<GraphicsAllocation *> allocations) {
+        for (auto allocation : allocations) {
+            allocation->prepareHostPtrForResidency(&queueCsr);
+        }
+        queueCsr.taskCount++;
+    }
+
+    static constexpr size_t hostMemorySize = 8 * MemoryConstants::pageSize;
+    std::unique_ptr<uint8_t[]> hostMemory;
+    uint8_t *hostPtr = nullptr;
+    std::unique_ptr<MockCommandStreamReceiver> queueCsrs[2];
+};
+
+TEST_F(HostPtrImportCacheTest, givenCachedAllocationWhenAcquiringRangeWithinItThenSameAllocationIsReturnedAndMarkedForTaskCountAssignment) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, HostPtrImportCache::defaultBudget);
+    auto allocation = importHostPtr(0, 2 * MemoryConstants::pageSize);
+
+    EXPECT_TRUE(cache.insert(allocation, queueCsr));
+    EXPECT_EQ(1u, allocation->hostPtrTaskCountAssignment.load());
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cache.getCachedBytes());
+    EXPECT_FALSE(cache.insert(allocation, queueCsr));
+
+    EXPECT_EQ(allocation, cache.acquire(hostPtr, 2 * MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(allocation, cache.acquire(ptrOffset(hostPtr, 64), MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(1u, allocation->hostPtrTaskCountAssignment.load());
+
+    EXPECT_EQ(nullptr, cache.acquire(ptrOffset(hostPtr, 4 * MemoryConstants::pageSize), MemoryConstants::pageSize, queueCsr));
+
+    submit(queueCsr, {allocation});
+    EXPECT_EQ(0u, allocation->hostPtrTaskCountAssignment.load());
+    EXPECT_EQ(allocation, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(1u, allocation->hostPtrTaskCountAssignment.load());
+    submit(queueCsr, {allocation});
+}
+
+TEST_F(HostPtrImportCacheTest, givenAllocationAcquiredMultipleTimesBeforeSubmissionWhenSubmittedThenItBecomesIdleAndCanBeEvicted) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, MemoryConstants::pageSize);
+    auto first = importHostPtr(0, MemoryConstants::pageSize);
+    auto second = importHostPtr(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+
+    EXPECT_TRUE(cache.insert(first, queueCsr));
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    EXPECT_FALSE(cache.insert(second, queueCsr));
+
+    submit(queueCsr, {first});
+    EXPECT_EQ(0u, first->hostPtrTaskCountAssignment.load());
+    EXPECT_EQ(queueCsr.peekTaskCount(), first->getTaskCount(queueCsr.getOsContext().getContextId()));
+
+    EXPECT_TRUE(cache.insert(second, queueCsr));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(nullptr, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    submit(queueCsr, {second});
+}
+
+TEST_F(HostPtrImportCacheTest, givenAllocationAcquiredByTwoCsrsWhenOnlyOneSubmitsThenItStaysPendingUntilBothSubmit) {
+    auto &csrA = *queueCsrs[0];
+    auto &csrB = *queueCsrs[1];
+    HostPtrImportCache cache(*memoryManager, MemoryConstants::pageSize);
+    auto first = importHostPtr(0, MemoryConstants::pageSize);
+    auto second = importHostPtr(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+
+    EXPECT_TRUE(cache.insert(first, csrA));
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, csrB));
+    EXPECT_EQ(2u, first->hostPtrTaskCountAssignment.load());
+
+    submit(csrA, {first});
+    EXPECT_EQ(1u, first->hostPtrTaskCountAssignment.load());
+    EXPECT_FALSE(cache.insert(second, csrA));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, csrB));
+    EXPECT_EQ(1u, first->hostPtrTaskCountAssignment.load());
+
+    submit(csrB, {first});
+    EXPECT_EQ(0u, first->hostPtrTaskCountAssignment.load());
+    EXPECT_TRUE(cache.insert(second, csrA));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(nullptr, cache.acquire(hostPtr, MemoryConstants::pageSize, csrA));
+    submit(csrA, {second});
+}
+
+TEST_F(HostPtrImportCacheTest, givenBudgetExceededWhenInsertingThenLeastRecentlyUsedIdleAllocationIsEvicted) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, 2 * MemoryConstants::pageSize);
+    auto first = importHostPtr(0, MemoryConstants::pageSize);
+    auto second = importHostPtr(2 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto third = importHostPtr(4 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+
+    EXPECT_TRUE(cache.insert(first, queueCsr));
+    EXPECT_TRUE(cache.insert(second, queueCsr));
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    submit(queueCsr, {first, second});
+
+    EXPECT_TRUE(cache.insert(third, queueCsr));
+    submit(queueCsr, {third});
+    EXPECT_EQ(2u, cache.getEntriesCount());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cache.getCachedBytes());
+    EXPECT_EQ(nullptr, cache.acquire(ptrOffset(hostPtr, 2 * MemoryConstants::pageSize), MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(first, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(third, cache.acquire(ptrOffset(hostPtr, 4 * MemoryConstants::pageSize), MemoryConstants::pageSize, queueCsr));
+    submit(queueCsr, {first, third});
+}
+
+TEST_F(HostPtrImportCacheTest, givenOnlyBusyAllocationsWhenInsertingOverBudgetThenInsertFailsAndCachedAllocationsAreKept) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, 2 * MemoryConstants::pageSize);
+    auto first = importHostPtr(0, 2 * MemoryConstants::pageSize);
+    auto second = importHostPtr(4 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    auto tooLarge = importHostPtr(6 * MemoryConstants::pageSize, 2 * MemoryConstants::pageSize + 1);
+
+    EXPECT_TRUE(cache.insert(first, queueCsr));
+    EXPECT_FALSE(cache.insert(second, queueCsr));
+    EXPECT_FALSE(cache.insert(tooLarge, queueCsr));
+    EXPECT_EQ(0u, second->hostPtrTaskCountAssignment.load());
+    EXPECT_EQ(1u, cache.getEntriesCount());
+
+    submit(queueCsr, {first});
+    EXPECT_TRUE(cache.insert(second, queueCsr));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    submit(queueCsr, {second});
+
+    memoryManager->freeGraphicsMemory(tooLarge);
+}
+
+TEST_F(HostPtrImportCacheTest, givenCachedAllocationsWhenInvalidatingRangeThenOnlyOverlappingAllocationsAreRemoved) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, HostPtrImportCache::defaultBudget);
+    auto first = importHostPtr(0, 2 * MemoryConstants::pageSize);
+    auto second = importHostPtr(4 * MemoryConstants::pageSize, MemoryConstants::pageSize);
+    EXPECT_TRUE(cache.insert(first, queueCsr));
+    EXPECT_TRUE(cache.insert(second, queueCsr));
+    submit(queueCsr, {first, second});
+
+    cache.invalidateRange(ptrOffset(hostPtr, MemoryConstants::pageSize), MemoryConstants::pageSize);
+    EXPECT_EQ(1u, cache.getEntriesCount());
+    EXPECT_EQ(MemoryConstants::pageSize, cache.getCachedBytes());
+    EXPECT_EQ(nullptr, cache.acquire(hostPtr, MemoryConstants::pageSize, queueCsr));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.getEntriesCount());
+    EXPECT_EQ(0u, cache.getCachedBytes());
+}
+
+TEST_F(HostPtrImportCacheTest, givenIdleCachedAllocationPartiallyOverlappingRangeWhenAcquireMissesThenAllocationIsDropped) {
+    auto &queueCsr = *queueCsrs[0];
+    HostPtrImportCache cache(*memoryManager, HostPtrImportCache::defaultBudget);
+    auto allocation = importHostPtr(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    EXPECT_TRUE(cache.insert(allocation, queueCsr));
+
+    EXPECT_EQ(nullptr, cache.acquire(hostPtr, 4 * MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(1u, cache.getEntriesCount());
+
+    submit(queueCsr, {allocation});
+    EXPECT_EQ(nullptr, cache.acquire(hostPtr, 4 * MemoryConstants::pageSize, queueCsr));
+    EXPECT_EQ(0u, cache.getEntriesCount());
+}
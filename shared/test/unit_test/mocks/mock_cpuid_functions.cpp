@@ -38,3 +38,11 @@ void mockCpuidReport36BitVirtualAddressSize(int *cpuInfo, int functionId) {
         mockCpuidEnableAll(cpuInfo, functionId);
     }
 }
+
+uint64_t mockXgetbvEnableAll(uint32_t xcr) {
+    return ~0ull;
+}
+
+uint64_t mockXgetbvAvxStateOnly(uint32_t xcr) {
+    return 0x7;
+}
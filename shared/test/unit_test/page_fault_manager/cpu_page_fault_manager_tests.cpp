@@ -402,6 +402,114 @@ TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProper
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenTrackedAllocationsWhenVerifyingAddressesAroundAllocationBoundariesThenOnlyAddressesInsideAllocationsAreHandled) {
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x20000);
+
+    pageFaultManager->insertAllocation(alloc2, 0x100, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), nullptr, {});
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0xFFFF)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x11000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x20100)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x10FFF)));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc1);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc2));
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationNeighbourhoodWhenVerifyingPageFaultThenAdjacentGpuDomainAllocsAreMigratedAndUnprotectedPerContiguousRange) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PageFaultManagerMigrationNeighbourhood.set(2);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+
+    void *allocs[] = {reinterpret_cast<void *>(0x100000),
+                      reinterpret_cast<void *>(0x101000),
+                      reinterpret_cast<void *>(0x104000),
+                      reinterpret_cast<void *>(0x105000),
+                      reinterpret_cast<void *>(0x106000),
+                      reinterpret_cast<void *>(0x107000)};
+    for (auto alloc : allocs) {
+        pageFaultManager->insertAllocation(alloc, 0x800, unifiedMemoryManager.get(), cmdQ, {});
+    }
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(allocs[2]));
+
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 5);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 2);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, allocs[2]);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 0x3000u);
+    EXPECT_EQ(pageFaultManager->setCpuAllocEvictableCalled, 5);
+    EXPECT_EQ(pageFaultManager->allowCPUMemoryEvictionCalled, 5);
+    EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 5u);
+
+    for (uint32_t i = 0; i < 5; i++) {
+        EXPECT_EQ(pageFaultManager->memoryData[allocs[i]].domain, PageFaultManager::AllocationDomain::cpu);
+    }
+    EXPECT_EQ(pageFaultManager->memoryData[allocs[5]].domain, PageFaultManager::AllocationDomain::gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationNeighbourhoodWhenNeighbourUsesDifferentQueueThenItIsNotMigrated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PageFaultManagerMigrationNeighbourhood.set(4);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *otherCmdQ = reinterpret_cast<void *>(0xEEEE);
+    void *alloc1 = reinterpret_cast<void *>(0x100000);
+    void *alloc2 = reinterpret_cast<void *>(0x101000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, unifiedMemoryManager.get(), otherCmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, unifiedMemoryManager.get(), cmdQ, {});
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(alloc2));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc1].domain, PageFaultManager::AllocationDomain::gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenFaultStormOverManySharedAllocsWhenMigrationNeighbourhoodIsSetThenFewerFaultsAndUnprotectCallsAreNeeded) {
+    constexpr uint32_t allocsCount = 4096;
+    constexpr size_t allocSize = MemoryConstants::pageSize;
+    auto baseAddress = reinterpret_cast<void *>(0x10000000);
+    for (uint32_t i = 0; i < allocsCount; i++) {
+        pageFaultManager->insertAllocation(ptrOffset(baseAddress, i * allocSize), allocSize, unifiedMemoryManager.get(), nullptr, {});
+    }
+
+    auto touchAllAllocations = [&]() {
+        int faults = 0;
+        for (uint32_t i = 0; i < allocsCount; i++) {
+            auto ptr = ptrOffset(baseAddress, i * allocSize + 8);
+            // only protected memory raises a fault
+            if (pageFaultManager->memoryData[ptrOffset(baseAddress, i * allocSize)].domain == PageFaultManager::AllocationDomain::gpu) {
+                EXPECT_TRUE(pageFaultManager->verifyPageFault(ptr));
+                faults++;
+            }
+        }
+        return faults;
+    };
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(static_cast<int>(allocsCount), touchAllAllocations());
+    EXPECT_EQ(static_cast<int>(allocsCount), pageFaultManager->allowMemoryAccessCalled);
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PageFaultManagerMigrationNeighbourhood.set(8);
+    pageFaultManager->allowMemoryAccessCalled = 0;
+    pageFaultManager->transferToCpuCalled = 0;
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    auto faults = touchAllAllocations();
+    EXPECT_EQ(static_cast<int>((allocsCount + 8) / 9), faults);
+    EXPECT_EQ(faults, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(static_cast<int>(allocsCount), pageFaultManager->transferToCpuCalled);
+}
+
 TEST_F(PageFaultManagerTest, givenInitialPlacementCpuWhenVerifyingPagefaultThenFirstAccessDoesNotInvokeTransfer) {
     void *alloc = reinterpret_cast<void *>(0x1);
 
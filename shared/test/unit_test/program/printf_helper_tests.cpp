@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,11 +8,14 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_output_worker.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_kernel_info.h"
 
 #include "gtest/gtest.h"
 
+#include <atomic>
 #include <cmath>
 
 using namespace NEO;
@@ -1004,6 +1007,99 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenFormatStringWhenCompilingThenLiteralsAndConversionsAreSplitIntoTokens) {
+    auto compiledFormat = PrintFormatter::compileFormatString("x=%d%% y=%v4hlx %ld\\n");
+
+    ASSERT_EQ(4u, compiledFormat->size());
+    EXPECT_EQ("x=", (*compiledFormat)[0].literal);
+    EXPECT_EQ("%d", (*compiledFormat)[0].format);
+    EXPECT_TRUE((*compiledFormat)[0].hasConversion);
+    EXPECT_FALSE((*compiledFormat)[0].isString);
+
+    EXPECT_EQ("% y=", (*compiledFormat)[1].literal);
+    EXPECT_EQ("%v4hlx", (*compiledFormat)[1].format);
+    EXPECT_EQ("%x", (*compiledFormat)[1].vectorFormat);
+
+    EXPECT_EQ(" ", (*compiledFormat)[2].literal);
+    EXPECT_EQ("%lld", (*compiledFormat)[2].longFormat);
+
+    EXPECT_EQ("\n", (*compiledFormat)[3].literal);
+    EXPECT_FALSE((*compiledFormat)[3].hasConversion);
+}
+
+TEST_F(PrintFormatterTest, GivenFormatStringUsedByManyPrintfCallsWhenPrintingThenItIsCompiledOnce) {
+    PrintfFormatCache formatCache;
+    printFormatter.reset(new PrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit,
+                                            &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap, &formatCache));
+
+    auto stringIndex = injectFormatString("%d;");
+    for (int value = 0; value < 3; value++) {
+        storeData(stringIndex);
+        injectValue(value);
+    }
+
+    std::string output;
+    printFormatter->printKernelOutput([&output](char *str) { output += str; });
+    EXPECT_EQ("0;1;2;", output);
+    EXPECT_EQ(1u, formatCache.getCompiledFormatsCount());
+
+    printFormatter->printKernelOutput([&output](char *str) { output += str; });
+    EXPECT_EQ("0;1;2;0;1;2;", output);
+    EXPECT_EQ(1u, formatCache.getCompiledFormatsCount());
+}
+
+TEST_F(PrintFormatterTest, GivenStreamingPrintfFormatterEnabledWhenPrintingManyPrintfCallsThenOutputIsPrintedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableStreamingPrintfFormatter.set(1);
+    printFormatter.reset(new PrintFormatter(static_cast<uint8_t *>(data->getUnderlyingBuffer()), printfBufferSize, is32bit,
+                                            &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap));
+
+    auto valueIndex = injectFormatString("value %d\\n");
+    auto stringIndex = injectFormatString("%s\\n");
+    auto textIndex = injectFormatString("text");
+    storeData(valueIndex);
+    injectValue(7);
+    storeData(stringIndex);
+    injectStringValue(textIndex);
+    storeData(valueIndex);
+    injectValue(8);
+
+    uint32_t printCalls = 0;
+    std::string output;
+    printFormatter->printKernelOutput([&](char *str) {
+        printCalls++;
+        output += str;
+    });
+    EXPECT_EQ(1u, printCalls);
+    EXPECT_EQ("value 7\ntext\nvalue 8\n", output);
+}
+
+TEST(PrintfOutputWorkerTest, GivenEnqueuedJobsWhenDrainingThenAllJobsAreExecutedInOrder) {
+    PrintfOutputWorker worker;
+    std::vector<int> executed;
+
+    for (int i = 0; i < 16; i++) {
+        worker.enqueue([&executed, i]() { executed.push_back(i); });
+    }
+    worker.drain();
+
+    ASSERT_EQ(16u, executed.size());
+    for (int i = 0; i < 16; i++) {
+        EXPECT_EQ(i, executed[i]);
+    }
+}
+
+TEST(PrintfOutputWorkerTest, GivenEnqueuedJobsWhenWorkerIsDestroyedThenPendingJobsAreExecuted) {
+    std::atomic<uint32_t> executed{0};
+    {
+        PrintfOutputWorker worker;
+        for (int i = 0; i < 16; i++) {
+            worker.enqueue([&executed]() { executed++; });
+        }
+    }
+    EXPECT_EQ(16u, executed.load());
+}
+
 TEST(printToStdoutTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToStdout("test");
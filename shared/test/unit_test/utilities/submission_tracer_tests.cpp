@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/submission_tracer.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <sstream>
+
+using namespace NEO;
+
+namespace CpuIntrinsicsTests {
+extern std::atomic<uint32_t> rdtscCounter;
+extern uint64_t rdtscRetValue;
+} // namespace CpuIntrinsicsTests
+
+TEST(LatencyHistogramTest, givenSmallValuesWhenGettingBucketIndexThenValueIsUsedAsIndex) {
+    for (uint64_t value = 0; value < LatencyHistogram::linearRange; value++) {
+        EXPECT_EQ(value, LatencyHistogram::getBucketIndex(value));
+        EXPECT_EQ(value, LatencyHistogram::getBucketLowerBound(static_cast<uint32_t>(value)));
+    }
+}
+
+TEST(LatencyHistogramTest, givenLargeValuesWhenGettingBucketThenLowerBoundIsWithinRelativeErrorOfValue) {
+    for (uint64_t value : {16ull, 17ull, 31ull, 100ull, 1000ull, 123456ull, 1ull << 40, std::numeric_limits<uint64_t>::max()}) {
+        auto bucketIndex = LatencyHistogram::getBucketIndex(value);
+        EXPECT_LT(bucketIndex, LatencyHistogram::bucketsCount);
+        auto lowerBound = LatencyHistogram::getBucketLowerBound(bucketIndex);
+        EXPECT_LE(lowerBound, value);
+        EXPECT_LE(value - lowerBound, lowerBound / LatencyHistogram::subBucketsPerPower);
+        EXPECT_EQ(bucketIndex, LatencyHistogram::getBucketIndex(lowerBound));
+    }
+}
+
+TEST(LatencyHistogramTest, givenRecordedValuesWhenGettingStatisticsThenCorrectValuesAreReturned) {
+    auto histogram = std::make_unique<LatencyHistogram>();
+    EXPECT_EQ(0u, histogram->getPercentile(50.0));
+
+    for (uint64_t value = 1; value <= 10; value++) {
+        histogram->record(value);
+    }
+    histogram->record(1000);
+
+    EXPECT_EQ(11u, histogram->getCount());
+    EXPECT_EQ(1055u, histogram->getSum());
+    EXPECT_EQ(1000u, histogram->getMax());
+    EXPECT_EQ(6u, histogram->getPercentile(50.0));
+    EXPECT_EQ(10u, histogram->getPercentile(90.0));
+    EXPECT_EQ(LatencyHistogram::getBucketLowerBound(LatencyHistogram::getBucketIndex(1000)), histogram->getPercentile(100.0));
+
+    auto other = std::make_unique<LatencyHistogram>();
+    other->record(2000);
+    histogram->merge(*other);
+    EXPECT_EQ(12u, histogram->getCount());
+    EXPECT_EQ(2000u, histogram->getMax());
+
+    histogram->reset();
+    EXPECT_EQ(0u, histogram->getCount());
+    EXPECT_EQ(0u, histogram->getMax());
+    EXPECT_EQ(0u, histogram->getBucketCount(LatencyHistogram::getBucketIndex(1000)));
+}
+
+TEST(SubmissionTracerTest, givenTracingDisabledWhenScopeIsUsedThenNothingIsRecorded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSubmissionTracing.set(0);
+    auto rdtscCountBefore = CpuIntrinsicsTests::rdtscCounter.load();
+    SubmissionTracer::get().reset();
+
+    {
+        SubmissionTraceScope traceScope(SubmissionStage::flushTask);
+    }
+
+    EXPECT_EQ(rdtscCountBefore, CpuIntrinsicsTests::rdtscCounter.load());
+    EXPECT_EQ(0u, SubmissionTracer::get().aggregate()->at(static_cast<uint32_t>(SubmissionStage::flushTask)).getCount());
+}
+
+TEST(SubmissionTracerTest, givenTracingEnabledWhenScopeIsUsedThenElapsedTicksAreRecordedForStage) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSubmissionTracing.set(1);
+    VariableBackup<uint64_t> rdtscBackup(&CpuIntrinsicsTests::rdtscRetValue, 100);
+    SubmissionTracer::get().reset();
+
+    {
+        SubmissionTraceScope traceScope(SubmissionStage::ringAppend);
+        CpuIntrinsicsTests::rdtscRetValue = 350;
+    }
+
+    auto histograms = SubmissionTracer::get().aggregate();
+    auto &ringAppend = histograms->at(static_cast<uint32_t>(SubmissionStage::ringAppend));
+    EXPECT_EQ(1u, ringAppend.getCount());
+    EXPECT_EQ(250u, ringAppend.getSum());
+    EXPECT_EQ(0u, histograms->at(static_cast<uint32_t>(SubmissionStage::hostWait)).getCount());
+
+    std::stringstream output;
+    SubmissionTracer::get().dump(output);
+    EXPECT_NE(std::string::npos, output.str().find("ringAppend, 1, 250"));
+    EXPECT_EQ(std::string::npos, output.str().find("hostWait"));
+
+    SubmissionTracer::get().reset();
+}
+
+TEST(SubmissionTracerTest, givenStagesWhenGettingNameThenNonEmptyNameIsReturned) {
+    for (uint32_t stage = 0; stage < SubmissionTracer::stagesCount; stage++) {
+        EXPECT_STRNE("", SubmissionTracer::getStageName(static_cast<SubmissionStage>(stage)));
+    }
+    EXPECT_STREQ("argumentPatching", SubmissionTracer::getStageName(SubmissionStage::argumentPatching));
+    EXPECT_STREQ("hostWait", SubmissionTracer::getStageName(SubmissionStage::hostWait));
+}
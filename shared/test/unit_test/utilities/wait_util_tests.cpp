@@ -98,3 +98,117 @@ TEST_F(WaitPredicateOnlyTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsC
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(CompletionTimeEstimatorTest, givenObservedWaitTimesWhenUpdatingThenEstimateConvergesToObservedValue) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    EXPECT_EQ(WaitUtils::CompletionTimeEstimator::initialEstimateNs, estimator.getEstimateNs());
+
+    estimator.update(WaitUtils::CompletionTimeEstimator::initialEstimateNs);
+    EXPECT_EQ(WaitUtils::CompletionTimeEstimator::initialEstimateNs, estimator.getEstimateNs());
+
+    for (uint32_t i = 0; i < 100; i++) {
+        estimator.update(800000u);
+    }
+    EXPECT_NEAR(800000.0, static_cast<double>(estimator.getEstimateNs()), 800000.0 * 0.01);
+
+    estimator.update(0u);
+    EXPECT_LT(estimator.getEstimateNs(), 800000u);
+}
+
+TEST(HybridWaitPolicyTest, givenEstimatesWhenCreatingPolicyThenBudgetsAreClamped) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    {
+        WaitUtils::HybridWaitPolicy policy(estimator);
+        EXPECT_EQ(WaitUtils::CompletionTimeEstimator::initialEstimateNs, policy.getSpinBudgetNs());
+        EXPECT_EQ(4 * WaitUtils::CompletionTimeEstimator::initialEstimateNs, policy.getMonitorWaitBudgetNs());
+    }
+
+    for (uint32_t i = 0; i < 200; i++) {
+        estimator.update(0u);
+    }
+    {
+        WaitUtils::HybridWaitPolicy policy(estimator);
+        EXPECT_EQ(WaitUtils::HybridWaitPolicy::minSpinBudgetNs, policy.getSpinBudgetNs());
+        EXPECT_EQ(WaitUtils::HybridWaitPolicy::minSpinBudgetNs, policy.getMonitorWaitBudgetNs());
+    }
+
+    for (uint32_t i = 0; i < 200; i++) {
+        estimator.update(100000000u);
+    }
+    {
+        WaitUtils::HybridWaitPolicy policy(estimator);
+        EXPECT_EQ(WaitUtils::HybridWaitPolicy::maxSpinBudgetNs, policy.getSpinBudgetNs());
+        EXPECT_EQ(WaitUtils::HybridWaitPolicy::maxMonitorWaitBudgetNs, policy.getMonitorWaitBudgetNs());
+    }
+}
+
+TEST(HybridWaitPolicyTest, givenElapsedTimeWhenGettingPhaseThenPhaseChangesAtBudgets) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    WaitUtils::HybridWaitPolicy policy(estimator);
+
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::Phase::spin, policy.getPhase(0u));
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::Phase::spin, policy.getPhase(policy.getSpinBudgetNs() - 1));
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::Phase::monitorWait, policy.getPhase(policy.getSpinBudgetNs()));
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::Phase::monitorWait, policy.getPhase(policy.getMonitorWaitBudgetNs() - 1));
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::Phase::backoff, policy.getPhase(policy.getMonitorWaitBudgetNs()));
+}
+
+TEST(HybridWaitPolicyTest, givenSpinPhaseWhenWaitingThenPauseIsCalledAndNoBackoffIsCounted) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    WaitUtils::HybridWaitPolicy policy(estimator);
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    policy.wait(nullptr, 0u);
+    EXPECT_EQ(oldCount + 1, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(0u, policy.getBackoffCount());
+}
+
+TEST(HybridWaitPolicyTest, givenBackoffPhaseWhenWaitingThenBackoffIsCountedAndPauseIsNotCalled) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    WaitUtils::HybridWaitPolicy policy(estimator);
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    policy.wait(nullptr, policy.getMonitorWaitBudgetNs());
+    policy.wait(nullptr, policy.getMonitorWaitBudgetNs());
+    EXPECT_EQ(oldCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(2u, policy.getBackoffCount());
+}
+
+TEST(HybridWaitPolicyTest, givenLongWaitWhenWaitingWithPolicyThenNumberOfBackoffsIsLogarithmicInWaitLength) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    WaitUtils::HybridWaitPolicy policy(estimator);
+
+    // the clock advances by each backoff sleep, and by 1us for every spin or monitor wait
+    constexpr uint64_t completionNs = 2000000u;
+    uint64_t elapsedNs = 0;
+    while (elapsedNs < completionNs) {
+        policy.wait(nullptr, elapsedNs);
+        if (policy.getPhase(elapsedNs) == WaitUtils::HybridWaitPolicy::Phase::backoff) {
+            elapsedNs += policy.getLastBackoffUs() * 1000u;
+        } else {
+            elapsedNs += 1000u;
+        }
+    }
+
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::maxBackoffUs, policy.getLastBackoffUs());
+    EXPECT_LT(0u, policy.getBackoffCount());
+    EXPECT_GE(20u, policy.getBackoffCount());
+}
+
+TEST(HybridWaitPolicyTest, givenFiniteTimeoutWhenBackingOffThenSleepIsShortenedToRemainingTime) {
+    WaitUtils::CompletionTimeEstimator estimator;
+    auto monitorWaitBudgetNs = WaitUtils::HybridWaitPolicy(estimator).getMonitorWaitBudgetNs();
+    auto timeoutNs = monitorWaitBudgetNs + 15000u;
+    WaitUtils::HybridWaitPolicy policy(estimator, timeoutNs);
+
+    policy.wait(nullptr, monitorWaitBudgetNs);
+    EXPECT_EQ(WaitUtils::HybridWaitPolicy::minBackoffUs, policy.getLastBackoffUs());
+
+    policy.wait(nullptr, monitorWaitBudgetNs + 10000u);
+    EXPECT_EQ(5u, policy.getLastBackoffUs());
+    EXPECT_EQ(2u, policy.getBackoffCount());
+
+    policy.wait(nullptr, timeoutNs);
+    EXPECT_EQ(0u, policy.getLastBackoffUs());
+    EXPECT_EQ(2u, policy.getBackoffCount());
+}
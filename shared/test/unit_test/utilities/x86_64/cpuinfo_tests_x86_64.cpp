@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,7 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 
@@ -32,6 +33,7 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
     CpuInfo testCpuInfo;
 
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 
@@ -40,15 +42,34 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
 
 TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     void (*defaultCpuidFunc)(int *, int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
     CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvEnableAll;
 
     CpuInfo testCpuInfo;
 
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitPkg));
 
     CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
+}
+
+TEST(CpuInfoTest, givenOsNotSavingAvx512StateWhenCpuReportsAvx512ThenAvx512FeatureIsNotSupported) {
+    void (*defaultCpuidFunc)(int *, int) = CpuInfo::cpuidFunc;
+    uint64_t (*defaultXgetbvFunc)(uint32_t) = CpuInfo::xgetbvFunc;
+    CpuInfo::cpuidFunc = mockCpuidEnableAll;
+    CpuInfo::xgetbvFunc = mockXgetbvAvxStateOnly;
+
+    CpuInfo testCpuInfo;
+
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
+
+    CpuInfo::cpuidFunc = defaultCpuidFunc;
+    CpuInfo::xgetbvFunc = defaultXgetbvFunc;
 }
 
 TEST(CpuInfoTest, WhenGettingVirtualAddressSizeThenCorrectResultIsReturned) {